@@ -0,0 +1,110 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                        BENCHMARKS FOR ARRAY FUNCTIONS                        #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# include	<Array.h>
+# include	"Benchmark.hpp"
+# include	"benchmark/BitPacking.hpp"
+# include	"benchmark/ParallelReduce.hpp"
+# include	"benchmark/ParallelSort.hpp"
+# include	"benchmark/ExternalSort.hpp"
+# include	"benchmark/BoundedSort.hpp"
+# include	"benchmark/AutoSort.hpp"
+# include	"benchmark/MultiColumnSort.hpp"
+# include	"benchmark/Permutation.hpp"
+# include	"benchmark/ObjectSort.hpp"
+# include	"benchmark/Selection.hpp"
+# include	"benchmark/SortedSet.hpp"
+# include	"benchmark/BatchInsert.hpp"
+# include	"benchmark/SearchTree.hpp"
+# include	"benchmark/LearnedIndex.hpp"
+# include	"benchmark/BatchCount.hpp"
+# include	"benchmark/HashDistinct.hpp"
+# include	"benchmark/GroupBy.hpp"
+# include	"benchmark/Dictionary.hpp"
+# include	"benchmark/RadixPartition.hpp"
+
+//****************************************************************************//
+//      Run all the benchmark functions                                       //
+//****************************************************************************//
+int main()
+try {
+
+	// Compression
+	BenchBitPacking();
+
+	// Parallel reductions
+	BenchParallelReduce();
+
+	// Parallel sort
+	BenchParallelSort();
+
+	// External sort
+	BenchExternalSort();
+
+	// Sort with a bounded temporary buffer
+	BenchBoundedSort();
+
+	// Automatic choice of the sort algorithm
+	BenchAutoSort();
+
+	// Multi-column lexicographic sort
+	BenchMultiColumnSort();
+
+	// Sort permutations
+	BenchPermutation();
+
+	// Object sort by extracted keys
+	BenchObjectSort();
+
+	// Selection of order statistics
+	BenchSelection();
+
+	// Operations on sorted sets
+	BenchSortedSet();
+
+	// Batch insert into sorted arrays
+	BenchBatchInsert();
+
+	// Static search trees
+	BenchSearchTree();
+
+	// Learned index
+	BenchLearnedIndex();
+
+	// Batched counting
+	BenchBatchCount();
+
+	// Hash-based distinct values
+	BenchHashDistinct();
+
+	// Group-by aggregation
+	BenchGroupBy();
+
+	// Dictionary encoding
+	BenchDictionary();
+
+	// Radix partition
+	BenchRadixPartition();
+
+	// Everything is OK
+	cout << "\nSUCCESS: All the benchmarks have been completed!" << endl;
+	return 0;
+}
+catch (const runtime_error &ex) {
+
+	// Something failed
+	cerr << ex.what() << endl;
+	return 1;
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
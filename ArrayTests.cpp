@@ -33,6 +33,25 @@
 # include	"array/Compare.hpp"
 # include	"array/Check.hpp"
 # include	"array/Hash.hpp"
+# include	"array/BitPacking.hpp"
+# include	"array/ParallelReduce.hpp"
+# include	"array/ParallelSort.hpp"
+# include	"array/ExternalSort.hpp"
+# include	"array/BoundedSort.hpp"
+# include	"array/AutoSort.hpp"
+# include	"array/MultiColumnSort.hpp"
+# include	"array/Permutation.hpp"
+# include	"array/ObjectSort.hpp"
+# include	"array/Selection.hpp"
+# include	"array/SortedSet.hpp"
+# include	"array/BatchInsert.hpp"
+# include	"array/SearchTree.hpp"
+# include	"array/LearnedIndex.hpp"
+# include	"array/BatchCount.hpp"
+# include	"array/HashDistinct.hpp"
+# include	"array/GroupBy.hpp"
+# include	"array/Dictionary.hpp"
+# include	"array/RadixPartition.hpp"
 
 //****************************************************************************//
 //      Run all the unit-test functions                                       //
@@ -192,6 +211,8 @@ try {
 	TestMergeSortDsc();
 	TestMergeSortKeyAsc();
 	TestMergeSortKeyDsc();
+	TestMergeSortKeyAscStable();
+	TestMergeSortKeyDscStable();
 	TestMergeSortObjAsc();
 	TestMergeSortObjDsc();
 
@@ -200,6 +221,8 @@ try {
 	TestRadixSortDsc();
 	TestRadixSortKeyAsc();
 	TestRadixSortKeyDsc();
+	TestRadixSortKeyAscStable();
+	TestRadixSortKeyDscStable();
 
 	// Comparison of arrays
 	TestCompare();
@@ -221,6 +244,110 @@ try {
 	TestHash32();
 	TestHash64();
 
+	// Bit packing
+	TestBitPacking();
+	TestBitPackedArrayPlain();
+	TestBitPackedArrayFOR();
+	TestBitPackedArrayDelta();
+
+	// Parallel reductions
+	TestParallelSum();
+	TestParallelSumSqr();
+	TestParallelSumMul();
+	TestReproducibleSum();
+	TestReproducibleSumSqr();
+	TestParallelMin();
+	TestParallelMax();
+	TestParallelMinMax();
+
+	// Parallel sort
+	TestParallelSortAsc();
+	TestParallelSortDsc();
+	TestParallelSortKeyAsc();
+	TestParallelSortKeyDsc();
+
+	// External sort
+	TestExternalSortAsc();
+	TestExternalSortDsc();
+	TestExternalSortKeyAsc();
+	TestExternalSortKeyDsc();
+
+	// Sort with a bounded temporary buffer
+	TestBoundedSortAsc();
+	TestBoundedSortDsc();
+
+	// Automatic choice of the sort algorithm
+	TestAutoSortAsc();
+	TestAutoSortDsc();
+
+	// Multi-column lexicographic sort
+	TestMultiColumnSort();
+
+	// Sort permutations
+	TestArgsortAsc();
+	TestArgsortDsc();
+	TestGather();
+
+	// Object sort by extracted keys
+	TestObjectSortAsc();
+	TestObjectSortDsc();
+	TestRecordSortAsc();
+	TestRecordSortDsc();
+
+	// Selection of order statistics
+	TestNthElement();
+	TestSmallestK();
+	TestLargestK();
+	TestQuantiles();
+
+	// Operations on sorted sets
+	TestSortedSetIntersection();
+	TestSortedSetUnion();
+	TestSortedSetDifference();
+	TestSortedSetIntersectionK();
+
+	// Batch insert into sorted arrays
+	TestBatchInsertAsc();
+	TestBatchInsertDsc();
+
+	// Static search trees
+	TestSearchTreeFindFirstEqual();
+	TestSearchTreeFindLastEqual();
+	TestSearchTreeFindGreat();
+	TestSearchTreeFindGreatOrEqual();
+	TestSearchTreeFindLess();
+	TestSearchTreeFindLessOrEqual();
+
+	// Learned index
+	TestLearnedIndexFindFirstEqual();
+	TestLearnedIndexFindLastEqual();
+	TestLearnedIndexFindGreat();
+	TestLearnedIndexFindGreatOrEqual();
+	TestLearnedIndexFindLess();
+	TestLearnedIndexFindLessOrEqual();
+
+	// Batched counting
+	TestBatchCountAsc();
+	TestBatchCountDsc();
+
+	// Hash-based distinct values
+	TestHashUnique();
+	TestHashDuplicates();
+
+	// Group-by aggregation
+	TestGroupByAuto();
+	TestGroupBySort();
+	TestGroupByHash();
+	TestGroupBySums();
+
+	// Dictionary encoding
+	TestDictionaryEncodeSorted();
+	TestDictionaryEncodeHash();
+
+	// Radix partition
+	TestRadixPartition();
+	TestRadixPartitionKey();
+
 	// Everything is OK
 	cout << "\nSUCCESS: All the tests have been passed!" << endl;
 	return 0;
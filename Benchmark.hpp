@@ -0,0 +1,112 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                     COMMON FUNCTIONS FOR THE BENCHMARKS                      #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<iostream>
+# include	<iomanip>
+# include	<string>
+# include	<chrono>
+# include	<vector>
+# include	<thread>
+# define	BENCH_SIZE		10000000	// Size of the benchmark data buffer
+# define	BENCH_SEED		100			// Seed value for the random number generator
+# define	BENCH_ROUNDS	5			// Benchmark rounds (the best time is taken)
+
+using namespace std;
+
+//****************************************************************************//
+//      Show a summary (stage information) of the benchmark we are running    //
+//****************************************************************************//
+void BenchInfo (
+	const string &name,
+	size_t size,
+	size_t rounds
+){
+	// Show a summary (stage information) of the benchmark we are running now
+	cout << "    Benchmarking '\e[1m\e[32m" << name;
+	cout << "\e[0m' on a " << size << "-long array in " << rounds << " rounds" << endl;
+}
+
+//****************************************************************************//
+//      Prevent the compiler from optimizing away a computed value            //
+//****************************************************************************//
+template <typename T>
+inline void Consume (const T &value) {
+	asm volatile ("" : : "r" (&value) : "memory");
+}
+
+//****************************************************************************//
+//      Measure the best wall time of a function in many rounds (seconds)     //
+//****************************************************************************//
+template <typename F>
+double BestTime (F &&func, size_t rounds = BENCH_ROUNDS) {
+	double best = 0.0;
+	for (size_t i = 0; i < rounds; i++) {
+		auto start = chrono::steady_clock::now();
+		func ();
+		auto stop = chrono::steady_clock::now();
+		double time = chrono::duration <double> (stop - start).count();
+		if (i == 0 || time < best)
+			best = time;
+	}
+	return best;
+}
+
+//****************************************************************************//
+//      Measure the best wall time of a function after a setup (seconds)      //
+//****************************************************************************//
+template <typename S, typename F>
+double BestTime (S &&setup, F &&func, size_t rounds = BENCH_ROUNDS) {
+	double best = 0.0;
+	for (size_t i = 0; i < rounds; i++) {
+		setup ();
+		auto start = chrono::steady_clock::now();
+		func ();
+		auto stop = chrono::steady_clock::now();
+		double time = chrono::duration <double> (stop - start).count();
+		if (i == 0 || time < best)
+			best = time;
+	}
+	return best;
+}
+
+//****************************************************************************//
+//      Thread counts to measure the scaling with                             //
+//****************************************************************************//
+
+// Powers of 2 up to the count of hardware threads, and all of them
+vector <size_t> ThreadCounts (void) {
+	const size_t hardware = max <size_t> (thread::hardware_concurrency (), 1);
+	vector <size_t> counts;
+	for (size_t threads = 1; threads < hardware; threads *= 2)
+		counts.push_back (threads);
+	counts.push_back (hardware);
+	return counts;
+}
+
+//****************************************************************************//
+//      Show a benchmark result as time and throughput                        //
+//****************************************************************************//
+void BenchResult (
+	const string &label,	// Label of the measured variant
+	double time,			// Best time in seconds
+	double amount,			// Amount of processed items
+	const string &unit		// Unit name of the processed items
+){
+	cout << "        " << left << setw (40) << label << right;
+	cout << fixed << setprecision (3) << setw (12) << time * 1.0e3 << " ms";
+	cout << setprecision (2) << setw (14) << amount / time / 1.0e6 << " M" << unit << "/s";
+	cout << defaultfloat << endl;
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,51 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                      BENCHMARKS FOR BITFIELD FUNCTIONS                       #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# include	<Array.h>
+# include	<BitField.h>
+# include	"Benchmark.hpp"
+# include	"benchmark/RoaringBitmap.hpp"
+# include	"benchmark/SetBitIterator.hpp"
+# include	"benchmark/BitmapQuery.hpp"
+# include	"benchmark/BloomFilter.hpp"
+
+//****************************************************************************//
+//      Run all the benchmark functions                                       //
+//****************************************************************************//
+int main()
+try {
+
+	// Search operations
+	BenchSetBitIterator();
+
+	// Compressed bitmaps
+	BenchRoaringBitmap();
+
+	// Bitmap queries
+	BenchBitmapQuery();
+
+	// Membership filters
+	BenchBloomFilter();
+
+	// Everything is OK
+	cout << "\nSUCCESS: All the benchmarks have been completed!" << endl;
+	return 0;
+}
+catch (const runtime_error &ex) {
+
+	// Something failed
+	cerr << ex.what() << endl;
+	return 1;
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
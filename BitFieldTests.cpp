@@ -12,6 +12,10 @@
 # include	"Common.hpp"
 # include	"bit_field/Bit.hpp"
 # include	"bit_field/Search.hpp"
+# include	"bit_field/RoaringBitmap.hpp"
+# include	"bit_field/BitmapQuery.hpp"
+# include	"bit_field/BloomFilter.hpp"
+# include	"bit_field/SetBitIterator.hpp"
 
 //****************************************************************************//
 //      Run all the unit-test functions                                       //
@@ -36,6 +40,21 @@ try {
 	TestCountBits();
 	TestCheckSetBit();
 	TestCheckResetBit();
+	TestSetBitIterator();
+
+	// Compressed bitmaps
+	TestRoaringSetBit();
+	TestRoaringResetBit();
+	TestRoaringSetBits();
+	TestRoaringResetBits();
+	TestRoaringFindSetBitFwd();
+	TestRoaringCountBits();
+
+	// Bitmap queries
+	TestBitmapQuery();
+
+	// Membership filters
+	TestBloomFilter();
 
 	// Everything is OK
 	cout << "\nSUCCESS: All the tests have been passed!" << endl;
@@ -8,15 +8,39 @@
 ################################################################################
 */
 # pragma	once
+# include	<limits>
+# include	<type_traits>
 # define	BUFFER_SIZE		10000	// Size of the data buffer
 # define	SEED			100		// Seed value for the random number generator
 # define	ROUNDS			100		// Test rounds
 # define	TRIES			3		// Tries in each round
 # define	EPSILON			1.0e-4	// Epsilon for the compare function
 # define	MAX_VALUE		10		// Max generated random value
+# define	THREAD_COUNTS	{1, 2, 3, 8}	// Thread counts of the tested pools
 
 using namespace std;
 
+//****************************************************************************//
+//      Maximum value of the arrays with few duplicates                       //
+//****************************************************************************//
+// The value is cut to the largest value of integer types
+template <typename T>
+T WideValue (uint64_t value = 1000000) {
+	if constexpr (is_integral_v <T>)
+		if (uint64_t (numeric_limits <T>::max()) < value)
+			return numeric_limits <T>::max();
+	return T (value);
+}
+
+//****************************************************************************//
+//      Maximum value of the sorted sets                                      //
+//****************************************************************************//
+// Sets of BUFFER_SIZE random values overlap, but do not fill the range
+template <typename T>
+T SetRange (void) {
+	return WideValue <T> (4 * BUFFER_SIZE);
+}
+
 //****************************************************************************//
 //      Show a summary (stage information) of the job we are doing            //
 //****************************************************************************//
@@ -118,6 +142,56 @@ void TestVector (
 	}
 }
 
+//****************************************************************************//
+//      Test key array sorting stability                                      //
+//****************************************************************************//
+template <typename T>
+void TestSortKeyStable (
+	void (*func)(T key[], const void* ptr[], T tkey[], const void* tptr[], size_t size)
+){
+	// Create an array of the target size
+	RandomArray <T> array (BUFFER_SIZE, SEED, MAX_VALUE);
+
+	// Create temporary arrays needed for the sort
+	RandomArray <T> temp (BUFFER_SIZE, SEED, MAX_VALUE);
+	RandomArray <size_t> ptr (BUFFER_SIZE, SEED, MAX_VALUE);
+	RandomArray <size_t> tptr (BUFFER_SIZE, SEED, MAX_VALUE);
+
+	// Run the test in many rounds with a random offset and element count
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random offset inside the array and a random number of elements
+		// to work with
+		size_t offset = array.Offset ();
+		size_t count = array.Count (offset);
+
+		// Do many tries with the same offset and element count, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the array with random data. Each key points to its
+			// original position
+			array.Populate ();
+			for (size_t k = 0; k < count; k++)
+				ptr.Data()[offset + k] = k;
+
+			// Apply the operation to the array data
+			func (array.Data() + offset, reinterpret_cast <const void**> (ptr.Data() + offset), temp.Data(), reinterpret_cast <const void**> (tptr.Data()), count);
+
+			// Equal keys should keep their original order
+			const T *key = array.Data() + offset;
+			const size_t *pos = ptr.Data() + offset;
+			for (size_t k = 1; k < count; k++) {
+				if (key[k] == key[k - 1] && pos[k] <= pos[k - 1]) {
+					const string type_name = DemangleTypeName (typeid (T).name());
+					throw runtime_error ("    Unstable order <" + type_name +
+					"> at [" + to_string (offset + k) + "]: Got position '" + to_string (pos[k]) +
+					"' after '" + to_string (pos[k - 1]) + "'");
+				}
+			}
+		}
+	}
+}
+
 /*
 ################################################################################
 #                                 END OF FILE                                  #
@@ -0,0 +1,114 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#          UNIT TESTS FOR THE AUTOMATIC CHOICE OF THE SORT ALGORITHM           #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	"../ext/AutoSort.hpp"
+
+//****************************************************************************//
+//      Sorter that always uses the same kernel                               //
+//****************************************************************************//
+AutoSort ForcedSorter (AutoSort::Kernel kernel) {
+	AutoSort::Table table;
+	for (size_t i = 0; i < AutoSort::INPUTS; i++)
+		for (size_t j = 0; j < AutoSort::BUCKETS; j++)
+			table.kernel[i][j] = kernel;
+	return AutoSort (table);
+}
+
+//****************************************************************************//
+//      Test function for automatic array sorting                             //
+//****************************************************************************//
+template <typename T>
+void TestAutoSort (
+	const AutoSort &sorter,
+	AutoSort::Kernel (AutoSort::*func)(T array[], T temp[], size_t size) const,
+	void (*ref)(T array[], size_t size)
+){
+	// Create an array of the target size
+	RandomArray <T> array (BUFFER_SIZE, SEED, MAX_VALUE);
+	mt19937_64 generator (SEED);
+
+	// Run the test in many rounds with a random offset and element count
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random offset inside the array and a random number of elements
+		// to work with
+		size_t offset = array.Offset ();
+		size_t count = array.Count (offset);
+
+		// Do many tries with the same offset and element count, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the array with random data. The second try makes it
+			// nearly sorted and the third one sorted
+			array.Populate ();
+			if (j % 3 == 1) {
+				ref (array.Data() + offset, count);
+				for (size_t k = 0; k < count / 100; k++)
+					swap (array.Data()[offset + generator () % count], array.Data()[offset + generator () % count]);
+			}
+			if (j % 3 == 2)
+				ref (array.Data() + offset, count);
+
+			// Make a copy for the reference implementation of the function
+			RandomArray <T> reference (array);
+
+			// Create a temporary array needed for the sort
+			RandomArray <T> temp (BUFFER_SIZE, SEED, MAX_VALUE);
+
+			// Apply the operation to the array data. Both the testing and the reference
+			AutoSort::Kernel kernel = (sorter.*func) (array.Data() + offset, temp.Data() + offset, count);
+			ref (reference.Data() + offset, count);
+
+			// Compare arrays for different elements
+			array.Compare (reference, EPSILON);
+
+			// Sorted arrays, which are long enough to be sampled, should be left
+			// as they are
+			if (j % 3 == 2 && count >= AutoSort::SAMPLE_RUNS * AutoSort::SAMPLE_RUN && kernel != AutoSort::NONE)
+				throw runtime_error ("    Sorted array of " + to_string (count) + " elements was sorted again");
+		}
+	}
+}
+
+//****************************************************************************//
+//      Unit test routines                                                    //
+//****************************************************************************//
+# define	AUTO_SORT_ARRAY(func,ref)											\
+void TestAuto##func (void) {													\
+	StageInfo ("AutoSort::" # func, BUFFER_SIZE, ROUNDS, TRIES);				\
+	for (AutoSort sorter : {AutoSort (),										\
+		ForcedSorter (AutoSort::QUICK),											\
+		ForcedSorter (AutoSort::MERGE),											\
+		ForcedSorter (AutoSort::RADIX)}) {										\
+		TestAutoSort <uint8_t> (sorter, &AutoSort::func <uint8_t>, ref);		\
+		TestAutoSort <uint16_t> (sorter, &AutoSort::func <uint16_t>, ref);		\
+		TestAutoSort <uint32_t> (sorter, &AutoSort::func <uint32_t>, ref);		\
+		TestAutoSort <uint64_t> (sorter, &AutoSort::func <uint64_t>, ref);		\
+		TestAutoSort <sint8_t> (sorter, &AutoSort::func <sint8_t>, ref);		\
+		TestAutoSort <sint16_t> (sorter, &AutoSort::func <sint16_t>, ref);		\
+		TestAutoSort <sint32_t> (sorter, &AutoSort::func <sint32_t>, ref);		\
+		TestAutoSort <sint64_t> (sorter, &AutoSort::func <sint64_t>, ref);		\
+		TestAutoSort <flt32_t> (sorter, &AutoSort::func <flt32_t>, ref);		\
+		TestAutoSort <flt64_t> (sorter, &AutoSort::func <flt64_t>, ref);		\
+		TestAutoSort <size_t> (sorter, &AutoSort::func <size_t>, ref);			\
+	}																			\
+}
+
+// Ascending sort order
+AUTO_SORT_ARRAY (SortAsc, RadixSortAsc)
+
+// Descending sort order
+AUTO_SORT_ARRAY (SortDsc, RadixSortDsc)
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,84 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#             UNIT TESTS FOR THE BATCHED COUNTING IN SORTED ARRAYS             #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	"../ext/BatchCount.hpp"
+
+//****************************************************************************//
+//      Test function for the batched counting                                //
+//****************************************************************************//
+template <typename T>
+void TestBatchCount (
+	void (*func)(size_t count[], const T array[], size_t size, const T values[], size_t queries),
+	bool reverse_order
+){
+	// Create arrays of the target size. The values to count also go a bit past
+	// the range of the array elements
+	RandomArray <T> array (BUFFER_SIZE, SEED, MAX_VALUE);
+	RandomArray <T> values (BUFFER_SIZE, SEED + 1, MAX_VALUE + 2);
+	vector <size_t> target (BUFFER_SIZE);
+
+	// Run the test in many rounds with a random offset and element count
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random offset inside the array and a random number of elements
+		// to work with. The query counts range from few values to the array size
+		size_t offset = array.Offset ();
+		size_t count = array.Count (offset);
+		size_t offset2 = values.Offset ();
+		size_t count2 = values.Count (offset2) >> (i % 12);
+
+		// Do many tries with the same offset and element count, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the arrays with random data and sort the target array
+			array.Populate ();
+			values.Populate ();
+			array.Sort (reverse_order);
+
+			// Apply the operation to the array data
+			const T *data = array.Data() + offset;
+			const T *query = values.Data() + offset2;
+			func (target.data(), data, count, query, count2);
+
+			// Compare the counts with the reference implementation
+			for (size_t k = 0; k < count2; k++)
+				array.CheckResult (target[k], Count <size_t, T> (data, count, query[k]), EPSILON);
+		}
+	}
+}
+
+//****************************************************************************//
+//      Unit test routines                                                    //
+//****************************************************************************//
+# define	BATCH_COUNT(func,reverse_order)										\
+void TestBatch##func (void) {													\
+	StageInfo ("BatchCount::" # func, BUFFER_SIZE, ROUNDS, TRIES);				\
+	TestBatchCount <uint8_t> (BatchCount::func, reverse_order);					\
+	TestBatchCount <uint16_t> (BatchCount::func, reverse_order);				\
+	TestBatchCount <uint32_t> (BatchCount::func, reverse_order);				\
+	TestBatchCount <uint64_t> (BatchCount::func, reverse_order);				\
+	TestBatchCount <sint8_t> (BatchCount::func, reverse_order);					\
+	TestBatchCount <sint16_t> (BatchCount::func, reverse_order);				\
+	TestBatchCount <sint32_t> (BatchCount::func, reverse_order);				\
+	TestBatchCount <sint64_t> (BatchCount::func, reverse_order);				\
+	TestBatchCount <size_t> (BatchCount::func, reverse_order);					\
+}
+
+// Ascending sort order
+BATCH_COUNT (CountAsc, false)
+
+// Descending sort order
+BATCH_COUNT (CountDsc, true)
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
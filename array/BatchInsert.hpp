@@ -0,0 +1,93 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#              UNIT TESTS FOR THE BATCH INSERT INTO SORTED ARRAYS              #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	"../ext/BatchInsert.hpp"
+
+//****************************************************************************//
+//      Test function for the batch insert                                    //
+//****************************************************************************//
+template <typename T>
+void TestBatchInsert (
+	size_t (*func)(T array[], size_t size, T batch[], size_t count),
+	void (*ref)(T target[], size_t size)
+){
+	// Create arrays of the target size
+	RandomArray <T> array (BUFFER_SIZE, SEED, MAX_VALUE);
+	RandomArray <T> batch (BUFFER_SIZE, SEED + 1, MAX_VALUE);
+	vector <T> target (2 * BUFFER_SIZE), reference (2 * BUFFER_SIZE);
+
+	// Run the test in many rounds with a random offset and element count
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random offset inside the array and a random number of elements
+		// to work with. The batch sizes range from few values to the array size
+		size_t offset = array.Offset ();
+		size_t count = array.Count (offset);
+		size_t offset2 = batch.Offset ();
+		size_t count2 = batch.Count (offset2) >> (i % 12);
+
+		// Do many tries with the same offset and element count, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the arrays with random data and sort the target array
+			array.Populate ();
+			batch.Populate ();
+			copy (array.Data() + offset, array.Data() + offset + count, target.begin());
+			ref (target.data(), count);
+
+			// Append the batch to the array and sort it again for the reference
+			copy (array.Data() + offset, array.Data() + offset + count, reference.begin());
+			copy (batch.Data() + offset2, batch.Data() + offset2 + count2, reference.begin() + count);
+			ref (reference.data(), count + count2);
+
+			// Apply the operation to the array data
+			const size_t size = func (target.data(), count, batch.Data() + offset2, count2);
+			if (size != count + count2)
+				throw runtime_error ("    Mismatch of the array size: Got '" + to_string (size) +
+				"' Expected '" + to_string (count + count2) + "'");
+
+			// Compare arrays for different elements
+			for (size_t k = 0; k < size; k++) {
+				if (target[k] != reference[k])
+					throw runtime_error ("    Mismatch of the element at [" + to_string (k) +
+					"]: Got '" + to_string (target[k]) + "' Expected '" + to_string (reference[k]) + "'");
+			}
+		}
+	}
+}
+
+//****************************************************************************//
+//      Unit test routines                                                    //
+//****************************************************************************//
+# define	BATCH_INSERT(func,ref)												\
+void TestBatch##func (void) {													\
+	StageInfo ("BatchInsert::" # func, BUFFER_SIZE, ROUNDS, TRIES);				\
+	TestBatchInsert <uint8_t> (BatchInsert::func, ref);							\
+	TestBatchInsert <uint16_t> (BatchInsert::func, ref);						\
+	TestBatchInsert <uint32_t> (BatchInsert::func, ref);						\
+	TestBatchInsert <uint64_t> (BatchInsert::func, ref);						\
+	TestBatchInsert <sint8_t> (BatchInsert::func, ref);							\
+	TestBatchInsert <sint16_t> (BatchInsert::func, ref);						\
+	TestBatchInsert <sint32_t> (BatchInsert::func, ref);						\
+	TestBatchInsert <sint64_t> (BatchInsert::func, ref);						\
+	TestBatchInsert <size_t> (BatchInsert::func, ref);							\
+}
+
+// Ascending sort order
+BATCH_INSERT (InsertAsc, QuickSortAsc)
+
+// Descending sort order
+BATCH_INSERT (InsertDsc, QuickSortDsc)
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
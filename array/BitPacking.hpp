@@ -0,0 +1,214 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                 UNIT TESTS FOR THE BIT-PACKED INTEGER ARRAYS                 #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	"../ext/BitPacking.hpp"
+
+//****************************************************************************//
+//      Test function for the bit packing kernels                             //
+//****************************************************************************//
+template <typename T>
+void TestBitPacking (void)
+{
+	// Create arrays of the target size
+	RandomArray <T> array (BUFFER_SIZE, SEED, MAX_VALUE);
+	vector <uint64_t> words (BUFFER_SIZE + 1);
+
+	// Run the test in many rounds with a random offset, element count and width
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random offset inside the array and a random number of elements
+		// to work with
+		size_t offset = array.Offset ();
+		size_t count = array.Count (offset);
+		size_t bits = array.Count (0) % (sizeof (T) * 8) + 1;
+
+		// Do many tries with the same offset and element count, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the array with random data of the target width
+			array.Populate ();
+			for (size_t k = 0; k < BUFFER_SIZE; k++) {
+				uint64_t value = static_cast <make_unsigned_t <T>> (array.Data()[k]);
+				value = value * 0x9E3779B97F4A7C15ULL + k;
+				if (bits < 64)
+					value &= (static_cast <uint64_t> (1) << bits) - 1;
+				array.Data()[k] = static_cast <T> (value);
+			}
+
+			// Make a copy with the inverted values in the target range
+			RandomArray <T> result (array);
+			Array::Not (result.Data() + offset, count);
+
+			// Pack and unpack the values
+			BitPacking::Pack (words.data(), array.Data() + offset, count, bits);
+			BitPacking::Unpack (result.Data() + offset, words.data(), count, bits);
+
+			// Compare the unpacked values with the original ones
+			result.CheckValues (array);
+
+			// Random access to the packed values
+			Array::Not (result.Data() + offset, count);
+			for (size_t k = 0; k < count; k++)
+				result.Data()[offset + k] = static_cast <T> (BitPacking::Get (words.data(), k, bits));
+			result.CheckValues (array);
+		}
+	}
+}
+
+//****************************************************************************//
+//      Test function for the encodings of the bit-packed arrays              //
+//****************************************************************************//
+template <typename T>
+void TestBitPackedArray (
+	typename BitPackedArray <T>::Encoding encoding
+){
+	// Create arrays of the target size
+	RandomArray <T> array (BUFFER_SIZE, SEED, MAX_VALUE);
+
+	// Run the test in many rounds with a random offset and element count
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random offset inside the array and a random number of elements
+		// to work with
+		size_t offset = array.Offset ();
+		size_t count = array.Count (offset);
+
+		// Do many tries with the same offset and element count, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the array with random data. The delta encoding needs
+			// the ascending order of the values
+			array.Populate ();
+			if (encoding == BitPackedArray <T>::DELTA)
+				array.Sort ();
+
+			// Make a copy with the inverted values in the target range
+			RandomArray <T> result (array);
+			Array::Not (result.Data() + offset, count);
+
+			// Pack and unpack the values
+			BitPackedArray <T> packed (array.Data() + offset, count, encoding);
+			packed.Unpack (result.Data() + offset);
+
+			// Compare the unpacked values with the original ones
+			result.CheckValues (array);
+
+			// Random access to the packed values
+			if (encoding != BitPackedArray <T>::DELTA) {
+				Array::Not (result.Data() + offset, count);
+				for (size_t k = 0; k < count; k++)
+					result.Data()[offset + k] = packed.Get (k);
+				result.CheckValues (array);
+			}
+
+			// Random values are in range [-MAX_VALUE, MAX_VALUE], so the offsets
+			// and the differences should be packed into a few bits
+			const size_t range = 2 * MAX_VALUE;
+			if (encoding != BitPackedArray <T>::PLAIN && packed.Bits () > BitPacking::Width (&range, 1)) {
+				throw runtime_error ("    Too wide packed values: Got '" +
+				to_string (packed.Bits ()) + "' bits");
+			}
+		}
+	}
+}
+
+//****************************************************************************//
+//      Unit test routines                                                    //
+//****************************************************************************//
+
+//============================================================================//
+//      Bit packing of integers                                               //
+//============================================================================//
+void TestBitPacking (void) {
+
+	// Show the stage info
+	StageInfo ("BitPacking::Pack", BUFFER_SIZE, ROUNDS, TRIES);
+
+	// Unsigned integer types
+	TestBitPacking <uint8_t> ();
+	TestBitPacking <uint16_t> ();
+	TestBitPacking <uint32_t> ();
+	TestBitPacking <uint64_t> ();
+
+	// Signed integer types
+	TestBitPacking <sint8_t> ();
+	TestBitPacking <sint16_t> ();
+	TestBitPacking <sint32_t> ();
+	TestBitPacking <sint64_t> ();
+}
+
+//============================================================================//
+//      Bit-packed arrays with the plain encoding                             //
+//============================================================================//
+void TestBitPackedArrayPlain (void) {
+
+	// Show the stage info
+	StageInfo ("BitPackedArray::PLAIN", BUFFER_SIZE, ROUNDS, TRIES);
+
+	// Unsigned integer types
+	TestBitPackedArray <uint8_t> (BitPackedArray <uint8_t>::PLAIN);
+	TestBitPackedArray <uint16_t> (BitPackedArray <uint16_t>::PLAIN);
+	TestBitPackedArray <uint32_t> (BitPackedArray <uint32_t>::PLAIN);
+	TestBitPackedArray <uint64_t> (BitPackedArray <uint64_t>::PLAIN);
+
+	// Signed integer types
+	TestBitPackedArray <sint8_t> (BitPackedArray <sint8_t>::PLAIN);
+	TestBitPackedArray <sint16_t> (BitPackedArray <sint16_t>::PLAIN);
+	TestBitPackedArray <sint32_t> (BitPackedArray <sint32_t>::PLAIN);
+	TestBitPackedArray <sint64_t> (BitPackedArray <sint64_t>::PLAIN);
+}
+
+//============================================================================//
+//      Bit-packed arrays with the frame of reference encoding                //
+//============================================================================//
+void TestBitPackedArrayFOR (void) {
+
+	// Show the stage info
+	StageInfo ("BitPackedArray::FOR", BUFFER_SIZE, ROUNDS, TRIES);
+
+	// Unsigned integer types
+	TestBitPackedArray <uint8_t> (BitPackedArray <uint8_t>::FOR);
+	TestBitPackedArray <uint16_t> (BitPackedArray <uint16_t>::FOR);
+	TestBitPackedArray <uint32_t> (BitPackedArray <uint32_t>::FOR);
+	TestBitPackedArray <uint64_t> (BitPackedArray <uint64_t>::FOR);
+
+	// Signed integer types
+	TestBitPackedArray <sint8_t> (BitPackedArray <sint8_t>::FOR);
+	TestBitPackedArray <sint16_t> (BitPackedArray <sint16_t>::FOR);
+	TestBitPackedArray <sint32_t> (BitPackedArray <sint32_t>::FOR);
+	TestBitPackedArray <sint64_t> (BitPackedArray <sint64_t>::FOR);
+}
+
+//============================================================================//
+//      Bit-packed arrays with the delta encoding                             //
+//============================================================================//
+void TestBitPackedArrayDelta (void) {
+
+	// Show the stage info
+	StageInfo ("BitPackedArray::DELTA", BUFFER_SIZE, ROUNDS, TRIES);
+
+	// Unsigned integer types
+	TestBitPackedArray <uint8_t> (BitPackedArray <uint8_t>::DELTA);
+	TestBitPackedArray <uint16_t> (BitPackedArray <uint16_t>::DELTA);
+	TestBitPackedArray <uint32_t> (BitPackedArray <uint32_t>::DELTA);
+	TestBitPackedArray <uint64_t> (BitPackedArray <uint64_t>::DELTA);
+
+	// Signed integer types
+	TestBitPackedArray <sint8_t> (BitPackedArray <sint8_t>::DELTA);
+	TestBitPackedArray <sint16_t> (BitPackedArray <sint16_t>::DELTA);
+	TestBitPackedArray <sint32_t> (BitPackedArray <sint32_t>::DELTA);
+	TestBitPackedArray <sint64_t> (BitPackedArray <sint64_t>::DELTA);
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,92 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#           UNIT TESTS FOR THE SORT WITH A BOUNDED TEMPORARY BUFFER            #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	"../ext/BoundedSort.hpp"
+
+# define	SORT_BUDGETS	{0, 1, 5, 25, 100}	// Temporary array sizes in percent of the array
+
+//****************************************************************************//
+//      Test function for array sorting with a bounded temporary array        //
+//****************************************************************************//
+template <typename T>
+void TestBoundedSort (
+	void (*func)(T array[], T temp[], size_t tsize, size_t size),
+	void (*ref)(T array[], size_t size)
+){
+	// Create an array of the target size
+	RandomArray <T> array (BUFFER_SIZE, SEED, MAX_VALUE);
+
+	// Run the test in many rounds with a random offset and element count
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random offset inside the array and a random number of elements
+		// to work with
+		size_t offset = array.Offset ();
+		size_t count = array.Count (offset);
+
+		// Do many tries with the same offset and element count, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the array with random data
+			array.Populate ();
+
+			// Make a copy for the reference implementation of the function
+			RandomArray <T> reference (array);
+			ref (reference.Data() + offset, count);
+
+			// Try temporary arrays of different size
+			for (size_t budget : SORT_BUDGETS) {
+
+				// Make a copy for the sort and create a temporary array of
+				// the budget size
+				RandomArray <T> sorted (array);
+				const size_t tsize = count * budget / 100;
+				RandomArray <T> temp (max <size_t> (tsize, 1), SEED, MAX_VALUE);
+
+				// Apply the operation to the array data
+				func (sorted.Data() + offset, temp.Data(), tsize, count);
+
+				// Compare arrays for different elements
+				sorted.Compare (reference, EPSILON);
+			}
+		}
+	}
+}
+
+//****************************************************************************//
+//      Unit test routines                                                    //
+//****************************************************************************//
+# define	BOUNDED_SORT_ARRAY(func,ref)										\
+void TestBounded##func (void) {													\
+	StageInfo ("BoundedSort::" # func, BUFFER_SIZE, ROUNDS, TRIES);				\
+	TestBoundedSort <uint8_t> (BoundedSort::func, ref);							\
+	TestBoundedSort <uint16_t> (BoundedSort::func, ref);						\
+	TestBoundedSort <uint32_t> (BoundedSort::func, ref);						\
+	TestBoundedSort <uint64_t> (BoundedSort::func, ref);						\
+	TestBoundedSort <sint8_t> (BoundedSort::func, ref);							\
+	TestBoundedSort <sint16_t> (BoundedSort::func, ref);						\
+	TestBoundedSort <sint32_t> (BoundedSort::func, ref);						\
+	TestBoundedSort <sint64_t> (BoundedSort::func, ref);						\
+	TestBoundedSort <flt32_t> (BoundedSort::func, ref);							\
+	TestBoundedSort <flt64_t> (BoundedSort::func, ref);							\
+	TestBoundedSort <size_t> (BoundedSort::func, ref);							\
+}
+
+// Ascending sort order
+BOUNDED_SORT_ARRAY (SortAsc, RadixSortAsc)
+
+// Descending sort order
+BOUNDED_SORT_ARRAY (SortDsc, RadixSortDsc)
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,101 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                    UNIT TESTS FOR THE DICTIONARY ENCODING                    #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<set>
+# include	<cstring>
+# include	"../ext/Dictionary.hpp"
+
+//****************************************************************************//
+//      Test function for the dictionary encoding                             //
+//****************************************************************************//
+template <typename T>
+void TestDictionary (
+	size_t (*func)(T dictionary[], uint32_t code[], const T array[], size_t size),
+	bool sorted
+){
+	// Check columns with few and with many distinct values
+	for (T max : {T (MAX_VALUE), WideValue <T> ()}) {
+
+		// Create arrays of the target size
+		RandomArray <T> array (BUFFER_SIZE, SEED, max);
+		vector <T> dictionary (BUFFER_SIZE), decoded (BUFFER_SIZE);
+		vector <uint32_t> code (BUFFER_SIZE);
+
+		// Run the test in many rounds with a random offset and element count
+		for (size_t i = 0; i < ROUNDS; i++) {
+
+			// Get a random offset inside the array and a random number of elements
+			// to work with
+			size_t offset = array.Offset ();
+			size_t count = array.Count (offset);
+
+			// Do many tries with the same offset and element count, but different data
+			for (size_t j = 0; j < TRIES; j++) {
+
+				// Populate the array with random data
+				array.Populate ();
+				const T *data = array.Data() + offset;
+
+				// Distinct values of the column for the reference
+				set <T> reference (data, data + count);
+
+				// Apply the operation to the array data
+				const size_t size = func (dictionary.data(), code.data(), data, count);
+				array.CheckResult (size, reference.size(), EPSILON);
+
+				// The sorted dictionary has the values in the ascending order
+				if (sorted && !equal (dictionary.begin(), dictionary.begin() + size, reference.begin()))
+					throw runtime_error ("    Mismatch of the dictionary: The values are not in the ascending order");
+
+				// Decode the column and compare the values bit by bit
+				Dictionary::Decode (decoded.data(), code.data(), count, dictionary.data());
+				for (size_t k = 0; k < count; k++) {
+					if (code[k] >= size)
+						throw runtime_error ("    Mismatch of the code at [" + to_string (k) +
+						"]: Got '" + to_string (code[k]) + "' Expected less than '" + to_string (size) + "'");
+					if (memcmp (&decoded[k], &data[k], sizeof (T)))
+						throw runtime_error ("    Mismatch of the decoded value at [" + to_string (k) +
+						"]: Got '" + to_string (decoded[k]) + "' Expected '" + to_string (data[k]) + "'");
+				}
+			}
+		}
+	}
+}
+
+//****************************************************************************//
+//      Unit test routines                                                    //
+//****************************************************************************//
+# define	DICTIONARY(func,sorted)												\
+void TestDictionary##func (void) {												\
+	StageInfo ("Dictionary::" # func, BUFFER_SIZE, ROUNDS, TRIES);				\
+	TestDictionary <uint8_t> (Dictionary::func, sorted);						\
+	TestDictionary <uint16_t> (Dictionary::func, sorted);						\
+	TestDictionary <uint32_t> (Dictionary::func, sorted);						\
+	TestDictionary <uint64_t> (Dictionary::func, sorted);						\
+	TestDictionary <sint8_t> (Dictionary::func, sorted);						\
+	TestDictionary <sint16_t> (Dictionary::func, sorted);						\
+	TestDictionary <sint32_t> (Dictionary::func, sorted);						\
+	TestDictionary <sint64_t> (Dictionary::func, sorted);						\
+	TestDictionary <size_t> (Dictionary::func, sorted);							\
+	TestDictionary <flt32_t> (Dictionary::func, sorted);						\
+	TestDictionary <flt64_t> (Dictionary::func, sorted);						\
+}
+
+// Sorted dictionary encoding
+DICTIONARY (EncodeSorted, true)
+
+// Hash dictionary encoding
+DICTIONARY (EncodeHash, false)
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,226 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                       UNIT TESTS FOR THE EXTERNAL SORT                       #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<fstream>
+# include	<filesystem>
+# include	"../ext/ExternalSort.hpp"
+
+# define	EXT_RUN_SIZE	8192	// Run size in bytes (a few runs per array)
+# define	EXT_MERGE_SIZE	4096	// Merge buffer size in bytes (a few refills per run)
+
+//****************************************************************************//
+//      Temporary files of the tests                                          //
+//****************************************************************************//
+const string ExtInput (void) {
+	return (filesystem::temp_directory_path () / "ExternalSortTest.in").string();
+}
+const string ExtOutput (void) {
+	return (filesystem::temp_directory_path () / "ExternalSortTest.out").string();
+}
+
+//****************************************************************************//
+//      Write the array to a file                                             //
+//****************************************************************************//
+void WriteFile (const string &path, const void *data, size_t bytes) {
+	ofstream file (path, ios::binary | ios::trunc);
+	file.write (static_cast <const char*> (data), bytes);
+	if (!file)
+		throw runtime_error ("    Can not write the file '" + path + "'");
+}
+
+//****************************************************************************//
+//      Read the file to the array                                            //
+//****************************************************************************//
+void ReadFile (const string &path, void *data, size_t bytes) {
+	if (filesystem::file_size (path) != bytes)
+		throw runtime_error ("    Wrong size of the file '" + path + "'");
+	ifstream file (path, ios::binary);
+	file.read (static_cast <char*> (data), bytes);
+	if (!file)
+		throw runtime_error ("    Can not read the file '" + path + "'");
+}
+
+//****************************************************************************//
+//      Test function for external file sorting                               //
+//****************************************************************************//
+template <typename T>
+void TestExternalSort (
+	size_t (*func)(const string &input, const string &output, size_t run_size, size_t buffer_size, bool direct),
+	void (*ref)(T array[], size_t size)
+){
+	// Create an array of the target size
+	RandomArray <T> array (BUFFER_SIZE, SEED, MAX_VALUE);
+
+	// Run the test in many rounds with a random offset and element count
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random offset inside the array and a random number of elements
+		// to work with
+		size_t offset = array.Offset ();
+		size_t count = array.Count (offset);
+
+		// Do many tries with the same offset and element count, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the array with random data
+			array.Populate ();
+
+			// Make a copy for the reference implementation of the function
+			RandomArray <T> reference (array);
+
+			// Sort the elements through the files, with and without the direct I/O
+			WriteFile (ExtInput (), array.Data() + offset, count * sizeof (T));
+			func (ExtInput (), ExtOutput (), EXT_RUN_SIZE, EXT_MERGE_SIZE, j % 2);
+			ReadFile (ExtOutput (), array.Data() + offset, count * sizeof (T));
+			ref (reference.Data() + offset, count);
+
+			// Compare arrays for different elements
+			array.Compare (reference, EPSILON);
+		}
+	}
+
+	// A file of broken records fails the sort, and the spill file of the runs
+	// is removed on the error too
+	if (sizeof (T) > 1) {
+		WriteFile (ExtInput (), array.Data(), sizeof (T) + 1);
+		bool failed = false;
+		try {
+			func (ExtInput (), ExtOutput (), EXT_RUN_SIZE, EXT_MERGE_SIZE, false);
+		}
+		catch (const runtime_error&) {
+			failed = true;
+		}
+		if (!failed)
+			throw runtime_error ("    The sort of a file of broken records did not fail");
+		if (filesystem::exists (ExtOutput () + ".runs"))
+			throw runtime_error ("    The spill file of the runs was not removed on the error");
+	}
+
+	// Remove the temporary files
+	filesystem::remove (ExtInput ());
+	filesystem::remove (ExtOutput ());
+}
+
+//****************************************************************************//
+//      Test function for external file sorting of key and value records      //
+//****************************************************************************//
+template <typename T>
+void TestExternalSortKey (
+	size_t (*func)(const string &input, const string &output, size_t run_size, size_t buffer_size, bool direct),
+	void (*ref)(T array[], size_t size)
+){
+	// Create an array of the target size
+	RandomArray <T> array (BUFFER_SIZE, SEED, MAX_VALUE);
+
+	// Run the test in many rounds with a random offset and element count
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random offset inside the array and a random number of elements
+		// to work with
+		size_t offset = array.Offset ();
+		size_t count = array.Count (offset);
+
+		// Do many tries with the same offset and element count, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the array with random data
+			array.Populate ();
+
+			// Make a copy for the reference implementation of the function
+			RandomArray <T> reference (array);
+
+			// Values linked to the keys
+			RandomArray <size_t> ptr (array);
+
+			// Sort the records through the files, with and without the direct I/O
+			vector <ExternalSort::Pair <T>> pairs (count);
+			for (size_t k = 0; k < count; k++)
+				pairs[k] = {array.Data()[offset + k], ptr.Data()[offset + k]};
+			WriteFile (ExtInput (), pairs.data(), count * sizeof (pairs[0]));
+			func (ExtInput (), ExtOutput (), EXT_RUN_SIZE, EXT_MERGE_SIZE, j % 2);
+			ReadFile (ExtOutput (), pairs.data(), count * sizeof (pairs[0]));
+			for (size_t k = 0; k < count; k++) {
+				array.Data()[offset + k] = pairs[k].key;
+				ptr.Data()[offset + k] = pairs[k].value;
+			}
+			ref (reference.Data() + offset, count);
+
+			// Compare arrays for different elements
+			array.Compare (reference, EPSILON);
+
+			// Check the connection between keys and values
+			ptr.CheckValues (array);
+		}
+	}
+
+	// Remove the temporary files
+	filesystem::remove (ExtInput ());
+	filesystem::remove (ExtOutput ());
+}
+
+//****************************************************************************//
+//      Unit test routines                                                    //
+//****************************************************************************//
+
+//============================================================================//
+//      Regular file sorting                                                  //
+//============================================================================//
+# define	EXTERNAL_SORT_ARRAY(func,ref)										\
+void TestExternal##func (void) {												\
+	StageInfo ("ExternalSort::" # func, BUFFER_SIZE, ROUNDS, TRIES);			\
+	TestExternalSort <uint8_t> (ExternalSort::func <uint8_t>, ref);				\
+	TestExternalSort <uint16_t> (ExternalSort::func <uint16_t>, ref);			\
+	TestExternalSort <uint32_t> (ExternalSort::func <uint32_t>, ref);			\
+	TestExternalSort <uint64_t> (ExternalSort::func <uint64_t>, ref);			\
+	TestExternalSort <sint8_t> (ExternalSort::func <sint8_t>, ref);				\
+	TestExternalSort <sint16_t> (ExternalSort::func <sint16_t>, ref);			\
+	TestExternalSort <sint32_t> (ExternalSort::func <sint32_t>, ref);			\
+	TestExternalSort <sint64_t> (ExternalSort::func <sint64_t>, ref);			\
+	TestExternalSort <flt32_t> (ExternalSort::func <flt32_t>, ref);				\
+	TestExternalSort <flt64_t> (ExternalSort::func <flt64_t>, ref);				\
+	TestExternalSort <size_t> (ExternalSort::func <size_t>, ref);				\
+}
+
+// Ascending sort order
+EXTERNAL_SORT_ARRAY (SortAsc, RadixSortAsc)
+
+// Descending sort order
+EXTERNAL_SORT_ARRAY (SortDsc, RadixSortDsc)
+
+//============================================================================//
+//      Key and value file sorting                                            //
+//============================================================================//
+# define	EXTERNAL_SORT_KEY(func,ref)											\
+void TestExternal##func (void) {												\
+	StageInfo ("ExternalSort::" # func, BUFFER_SIZE, ROUNDS, TRIES);			\
+	TestExternalSortKey <uint8_t> (ExternalSort::func <uint8_t>, ref);			\
+	TestExternalSortKey <uint16_t> (ExternalSort::func <uint16_t>, ref);		\
+	TestExternalSortKey <uint32_t> (ExternalSort::func <uint32_t>, ref);		\
+	TestExternalSortKey <uint64_t> (ExternalSort::func <uint64_t>, ref);		\
+	TestExternalSortKey <sint8_t> (ExternalSort::func <sint8_t>, ref);			\
+	TestExternalSortKey <sint16_t> (ExternalSort::func <sint16_t>, ref);		\
+	TestExternalSortKey <sint32_t> (ExternalSort::func <sint32_t>, ref);		\
+	TestExternalSortKey <sint64_t> (ExternalSort::func <sint64_t>, ref);		\
+	TestExternalSortKey <flt32_t> (ExternalSort::func <flt32_t>, ref);			\
+	TestExternalSortKey <flt64_t> (ExternalSort::func <flt64_t>, ref);			\
+	TestExternalSortKey <size_t> (ExternalSort::func <size_t>, ref);			\
+}
+
+// Ascending sort order
+EXTERNAL_SORT_KEY (SortKeyAsc, RadixSortAsc)
+
+// Descending sort order
+EXTERNAL_SORT_KEY (SortKeyDsc, RadixSortDsc)
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
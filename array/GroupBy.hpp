@@ -0,0 +1,183 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                   UNIT TESTS FOR THE GROUP-BY AGGREGATION                    #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<map>
+# include	"../ext/GroupBy.hpp"
+
+//****************************************************************************//
+//      Test function for the group-by aggregation                            //
+//****************************************************************************//
+template <typename K, typename V>
+void TestGroupBy (GroupBy::Method method) {
+
+	// Aggregates of a group in the reference implementation
+	struct Group
+	{
+		size_t	count;		// Count of rows
+		V		sum;		// Sum of the values
+		V		min;		// Min value
+		V		max;		// Max value
+	};
+
+	// Check key columns with few and with many groups
+	for (K max : {K (MAX_VALUE), WideValue <K> ()}) {
+
+		// Create arrays of the target size
+		RandomArray <K> key (BUFFER_SIZE, SEED, max);
+		RandomArray <V> value (BUFFER_SIZE, SEED + 1, MAX_VALUE);
+		vector <K> groups (BUFFER_SIZE);
+		vector <size_t> counts (BUFFER_SIZE);
+		vector <V> sums (BUFFER_SIZE), mins (BUFFER_SIZE), maxs (BUFFER_SIZE);
+
+		// Run the test in many rounds with a random offset and element count
+		for (size_t i = 0; i < ROUNDS; i++) {
+
+			// Get a random offset inside the array and a random number of elements
+			// to work with
+			size_t offset = key.Offset ();
+			size_t count = key.Count (offset);
+
+			// Do many tries with the same offset and element count, but different data
+			for (size_t j = 0; j < TRIES; j++) {
+
+				// Populate the columns with random data
+				key.Populate ();
+				value.Populate ();
+				const K *kdata = key.Data() + offset;
+				const V *vdata = value.Data() + offset;
+
+				// Aggregate the rows in an ordered map for the reference
+				map <K, Group> reference;
+				for (size_t k = 0; k < count; k++) {
+					auto [it, inserted] = reference.try_emplace (kdata[k], Group {0, 0, vdata[k], vdata[k]});
+					Group &group = it->second;
+					group.count++;
+					group.sum += vdata[k];
+					group.min = vdata[k] < group.min ? vdata[k] : group.min;
+					group.max = vdata[k] > group.max ? vdata[k] : group.max;
+				}
+
+				// Apply the operation to the columns
+				const size_t computed = GroupBy::Aggregate (groups.data(), counts.data(), sums.data(), mins.data(), maxs.data(), kdata, vdata, count, method);
+				key.CheckResult (computed, reference.size(), EPSILON);
+
+				// Compare the groups with the reference
+				size_t g = 0;
+				for (const auto &[k, group] : reference) {
+					if (groups[g] != k)
+						throw runtime_error ("    Mismatch of the group key at [" + to_string (g) +
+						"]: Got '" + to_string (groups[g]) + "' Expected '" + to_string (k) + "'");
+					key.CheckResult (counts[g], group.count, EPSILON);
+					value.CheckResult (sums[g], group.sum, EPSILON);
+					value.CheckResult (mins[g], group.min, EPSILON);
+					value.CheckResult (maxs[g], group.max, EPSILON);
+					g++;
+				}
+			}
+		}
+	}
+}
+
+//****************************************************************************//
+//      Test function for the floating-point sums of all the algorithms       //
+//****************************************************************************//
+template <typename K, typename V>
+void TestGroupBySums (void) {
+
+	// Check key columns with few and with many groups
+	for (K max : {K (MAX_VALUE), WideValue <K> ()}) {
+
+		// Create arrays of the target size
+		RandomArray <K> key (BUFFER_SIZE, SEED, max);
+		RandomArray <V> value (BUFFER_SIZE, SEED + 1, MAX_VALUE);
+		vector <K> groups (BUFFER_SIZE);
+		vector <size_t> counts (BUFFER_SIZE);
+		vector <V> mins (BUFFER_SIZE), maxs (BUFFER_SIZE);
+		vector <V> sums [3] = {vector <V> (BUFFER_SIZE), vector <V> (BUFFER_SIZE), vector <V> (BUFFER_SIZE)};
+		const GroupBy::Method methods [3] = {GroupBy::AUTO, GroupBy::SORT, GroupBy::HASH};
+
+		// Run the test in many rounds with a random offset and element count
+		for (size_t i = 0; i < ROUNDS; i++) {
+
+			// Get a random offset inside the array and a random number of elements
+			// to work with
+			size_t offset = key.Offset ();
+			size_t count = key.Count (offset);
+
+			// Do many tries with the same offset and element count, but different data
+			for (size_t j = 0; j < TRIES; j++) {
+
+				// Populate the columns with random data. Values of very different
+				// magnitudes make the sums depend on the order of the additions
+				key.Populate ();
+				value.Populate ();
+				const K *kdata = key.Data() + offset;
+				V *vdata = value.Data() + offset;
+				for (size_t k = 0; k < count; k++)
+					vdata[k] = (vdata[k] + V (0.1)) * (k % 2 ? V (1.0e-6) : V (1.0e6)) / V (3);
+
+				// Apply all the algorithms to the columns
+				size_t computed [3];
+				for (size_t m = 0; m < 3; m++)
+					computed[m] = GroupBy::Aggregate (groups.data(), counts.data(), sums[m].data(), mins.data(), maxs.data(), kdata, vdata, count, methods[m]);
+
+				// The sums should be the same within the rounding error
+				for (size_t m = 1; m < 3; m++) {
+					key.CheckResult (computed[m], computed[0], EPSILON);
+					for (size_t g = 0; g < computed[0]; g++)
+						value.CheckResult (sums[m][g], sums[0][g], EPSILON);
+				}
+			}
+		}
+	}
+}
+
+//****************************************************************************//
+//      Unit test routines                                                    //
+//****************************************************************************//
+# define	GROUP_BY(name,method)												\
+void TestGroupBy##name (void) {													\
+	StageInfo ("GroupBy::" # name, BUFFER_SIZE, ROUNDS, TRIES);					\
+	TestGroupBy <uint8_t, flt64_t> (GroupBy::method);							\
+	TestGroupBy <uint16_t, flt64_t> (GroupBy::method);							\
+	TestGroupBy <uint32_t, flt64_t> (GroupBy::method);							\
+	TestGroupBy <uint64_t, flt64_t> (GroupBy::method);							\
+	TestGroupBy <sint8_t, flt64_t> (GroupBy::method);							\
+	TestGroupBy <sint16_t, flt64_t> (GroupBy::method);							\
+	TestGroupBy <sint32_t, flt64_t> (GroupBy::method);							\
+	TestGroupBy <sint64_t, flt64_t> (GroupBy::method);							\
+	TestGroupBy <size_t, flt64_t> (GroupBy::method);							\
+	TestGroupBy <sint32_t, flt32_t> (GroupBy::method);							\
+	TestGroupBy <uint32_t, sint64_t> (GroupBy::method);							\
+}
+
+// Automatic choice of the algorithm
+GROUP_BY (Auto, AUTO)
+
+// Aggregation by sorting
+GROUP_BY (Sort, SORT)
+
+// Aggregation in a hash table
+GROUP_BY (Hash, HASH)
+
+// Same floating-point sums of all the algorithms
+void TestGroupBySums (void) {
+	StageInfo ("GroupBy::Aggregate (sums)", BUFFER_SIZE, ROUNDS, TRIES);
+	TestGroupBySums <uint16_t, flt32_t> ();
+	TestGroupBySums <uint32_t, flt32_t> ();
+	TestGroupBySums <uint64_t, flt64_t> ();
+	TestGroupBySums <sint32_t, flt64_t> ();
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,101 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                UNIT TESTS FOR THE HASH-BASED DISTINCT VALUES                 #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<numeric>
+# include	"../ext/HashDistinct.hpp"
+
+//****************************************************************************//
+//      Test function for the hash-based distinct values                      //
+//****************************************************************************//
+template <typename T>
+void TestHashDistinct (bool duplicates) {
+
+	// Check arrays with many and with few duplicates
+	for (T max : {T (MAX_VALUE), WideValue <T> ()}) {
+
+		// Create an array of the target size
+		RandomArray <T> array (BUFFER_SIZE, SEED, max);
+		vector <T> unique (BUFFER_SIZE), ref_unique (BUFFER_SIZE), sorted (BUFFER_SIZE);
+		vector <size_t> counts (BUFFER_SIZE), ref_counts (BUFFER_SIZE), order (BUFFER_SIZE);
+
+		// Run the test in many rounds with a random offset and element count
+		for (size_t i = 0; i < ROUNDS; i++) {
+
+			// Get a random offset inside the array and a random number of elements
+			// to work with
+			size_t offset = array.Offset ();
+			size_t count = array.Count (offset);
+
+			// Do many tries with the same offset and element count, but different data
+			for (size_t j = 0; j < TRIES; j++) {
+
+				// Populate the array with random data
+				array.Populate ();
+
+				// Sort a copy of the array for the reference implementation
+				const T *data = array.Data() + offset;
+				copy (data, data + count, sorted.begin());
+				sort (sorted.begin(), sorted.begin() + count);
+				const size_t correct = Array::Duplicates (ref_unique.data(), ref_counts.data(), sorted.data(), count);
+
+				// Check a table of few slots, which is partitioned, and the default table
+				for (size_t slots : {size_t (16), HashDistinct::TABLE_SIZE}) {
+
+					// Apply the operation to the unsorted array data
+					const size_t computed = duplicates ?
+						HashDistinct::Duplicates (unique.data(), counts.data(), data, count, slots) :
+						HashDistinct::Unique (unique.data(), data, count, slots);
+					array.CheckResult (computed, correct, EPSILON);
+
+					// Sort the distinct values and compare them with the reference
+					iota (order.begin(), order.begin() + computed, 0);
+					sort (order.begin(), order.begin() + computed, [&](size_t a, size_t b){ return unique[a] < unique[b]; });
+					for (size_t k = 0; k < computed; k++) {
+						if (unique[order[k]] != ref_unique[k])
+							throw runtime_error ("    Mismatch of the value at [" + to_string (k) +
+							"]: Got '" + to_string (unique[order[k]]) + "' Expected '" + to_string (ref_unique[k]) + "'");
+						if (duplicates && counts[order[k]] != ref_counts[k])
+							throw runtime_error ("    Mismatch of the count at [" + to_string (k) +
+							"]: Got '" + to_string (counts[order[k]]) + "' Expected '" + to_string (ref_counts[k]) + "'");
+					}
+				}
+			}
+		}
+	}
+}
+
+//****************************************************************************//
+//      Unit test routines                                                    //
+//****************************************************************************//
+# define	HASH_DISTINCT(func,duplicates)										\
+void TestHash##func (void) {													\
+	StageInfo ("HashDistinct::" # func, BUFFER_SIZE, ROUNDS, TRIES);			\
+	TestHashDistinct <uint8_t> (duplicates);									\
+	TestHashDistinct <uint16_t> (duplicates);									\
+	TestHashDistinct <uint32_t> (duplicates);									\
+	TestHashDistinct <uint64_t> (duplicates);									\
+	TestHashDistinct <sint8_t> (duplicates);									\
+	TestHashDistinct <sint16_t> (duplicates);									\
+	TestHashDistinct <sint32_t> (duplicates);									\
+	TestHashDistinct <sint64_t> (duplicates);									\
+	TestHashDistinct <size_t> (duplicates);										\
+}
+
+// Unique values
+HASH_DISTINCT (Unique, false)
+
+// Duplicate values
+HASH_DISTINCT (Duplicates, true)
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,104 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                       UNIT TESTS FOR THE LEARNED INDEX                       #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<limits>
+# include	"../ext/LearnedIndex.hpp"
+
+//****************************************************************************//
+//      Test function for the learned index                                   //
+//****************************************************************************//
+template <typename T, typename F>
+void TestLearnedIndex (
+	F func,						// Search function of the index
+	size_t (*ref)(const T target[], size_t size, T value)
+){
+	// Check arrays with many and with few duplicates
+	for (T max : {T (MAX_VALUE), WideValue <T> (1000000000)}) {
+
+		// Create an array of the target size
+		RandomArray <T> array (BUFFER_SIZE, SEED, max);
+
+		// Run the test in many rounds with a random offset and element count
+		for (size_t i = 0; i < ROUNDS; i++) {
+
+			// Get a random offset inside the array and a random number of elements
+			// to work with
+			size_t offset = array.Offset ();
+			size_t count = array.Count (offset);
+
+			// Do many tries with the same offset and element count, but different data
+			for (size_t j = 0; j < TRIES; j++) {
+
+				// Populate the array with random data
+				array.Populate ();
+
+				// Sort the array in the ascending order
+				array.Sort (false);
+
+				// Search the extremes of the type, the array elements and the
+				// values next to them
+				const T *data = array.Data() + offset;
+				vector <T> values {numeric_limits <T>::min(), numeric_limits <T>::max()};
+				for (size_t k = 0; k < count; k += 1 + count / 16) {
+					values.push_back (data[k]);
+					values.push_back (data[k] - 1);
+					values.push_back (data[k] + 1);
+				}
+
+				// Reference results of the search
+				vector <size_t> correct;
+				for (T value : values)
+					correct.push_back (ref (data, count, value));
+
+				// Check the indices of different max errors
+				for (size_t error : {size_t (0), size_t (1), size_t (8), LearnedIndex <T>::DEFAULT_ERROR}) {
+					const LearnedIndex <T> index (data, count, error);
+					for (size_t k = 0; k < values.size(); k++)
+						array.CheckResult (func (index, values[k]), correct[k], EPSILON);
+				}
+			}
+		}
+	}
+}
+
+//****************************************************************************//
+//      Unit test routines                                                    //
+//****************************************************************************//
+# define	LEARNED_INDEX(func,ref)												\
+void TestLearnedIndex##func (void) {											\
+	StageInfo ("LearnedIndex::" # func, BUFFER_SIZE, ROUNDS, TRIES);			\
+	auto search = [](auto &index, auto value){ return index.func (value); };	\
+	TestLearnedIndex <uint64_t> (search, ref);									\
+	TestLearnedIndex <sint64_t> (search, ref);									\
+}
+
+// Searching for the first equal element
+LEARNED_INDEX (FindFirstEqual, FindFirstEqual)
+
+// Searching for the last equal element
+LEARNED_INDEX (FindLastEqual, FindLastEqual)
+
+// Searching for a greater element
+LEARNED_INDEX (FindGreat, FindGreatAsc)
+
+// Searching for a greater or equal element
+LEARNED_INDEX (FindGreatOrEqual, FindGreatOrEqualAsc)
+
+// Searching for a less element
+LEARNED_INDEX (FindLess, FindLessAsc)
+
+// Searching for a less or equal element
+LEARNED_INDEX (FindLessOrEqual, FindLessOrEqualAsc)
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -202,6 +202,28 @@ MERGE_SORT_KEY (MergeSortKeyAsc, MergeSortAsc)
 // Descending sort order
 MERGE_SORT_KEY (MergeSortKeyDsc, MergeSortDsc)
 
+# define	MERGE_SORT_KEY_STABLE(func)											\
+void Test##func##Stable (void) {												\
+	StageInfo ("Array::" # func " (stability)", BUFFER_SIZE, ROUNDS, TRIES);	\
+	TestSortKeyStable <uint8_t> (Array::func);									\
+	TestSortKeyStable <uint16_t> (Array::func);									\
+	TestSortKeyStable <uint32_t> (Array::func);									\
+	TestSortKeyStable <uint64_t> (Array::func);									\
+	TestSortKeyStable <sint8_t> (Array::func);									\
+	TestSortKeyStable <sint16_t> (Array::func);									\
+	TestSortKeyStable <sint32_t> (Array::func);									\
+	TestSortKeyStable <sint64_t> (Array::func);									\
+	TestSortKeyStable <flt32_t> (Array::func);									\
+	TestSortKeyStable <flt64_t> (Array::func);									\
+	TestSortKeyStable <size_t> (Array::func);									\
+}
+
+// Ascending sort order
+MERGE_SORT_KEY_STABLE (MergeSortKeyAsc)
+
+// Descending sort order
+MERGE_SORT_KEY_STABLE (MergeSortKeyDsc)
+
 //============================================================================//
 //      Object array sorting                                                  //
 //============================================================================//
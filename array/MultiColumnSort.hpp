@@ -0,0 +1,103 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#              UNIT TESTS FOR THE MULTI-COLUMN LEXICOGRAPHIC SORT              #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<tuple>
+# include	"../ext/MultiColumnSort.hpp"
+
+//****************************************************************************//
+//      Compare two values of a column in the column order                    //
+//****************************************************************************//
+template <typename T>
+sint64_t CmpColumn (T a, T b, MultiColumnSort::Order order) {
+	const sint64_t result = (a > b) - (a < b);
+	return order == MultiColumnSort::ASC ? result : -result;
+}
+
+//****************************************************************************//
+//      Test function for multi-column sorting                                //
+//****************************************************************************//
+template <typename A, typename B, typename C>
+void TestMultiColumnSort (
+	MultiColumnSort::Order oa,
+	MultiColumnSort::Order ob,
+	MultiColumnSort::Order oc,
+	MultiColumnSort::Algorithm algorithm
+){
+	// Create the columns of the target size
+	RandomArray <A> a (BUFFER_SIZE, SEED, MAX_VALUE);
+	RandomArray <B> b (BUFFER_SIZE, SEED + 1, MAX_VALUE);
+	RandomArray <C> c (BUFFER_SIZE, SEED + 2, MAX_VALUE);
+
+	// Run the test in many rounds with a random offset and element count
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random offset inside the columns and a random number of rows
+		// to work with
+		size_t offset = a.Offset ();
+		size_t count = a.Count (offset);
+
+		// Do many tries with the same offset and element count, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the columns with random data
+			a.Populate ();
+			b.Populate ();
+			c.Populate ();
+
+			// Apply the sort to the columns
+			MultiColumnSort sorter;
+			sorter.Column (a.Data() + offset, oa).Column (b.Data() + offset, ob).Column (c.Data() + offset, oc);
+			vector <size_t> rows (count);
+			sorter.Sort (rows.data(), count, algorithm);
+
+			// Stable sort of the row indices with a lexicographic comparator
+			vector <size_t> reference (count);
+			for (size_t k = 0; k < count; k++)
+				reference[k] = k;
+			const A *ca = a.Data() + offset;
+			const B *cb = b.Data() + offset;
+			const C *cc = c.Data() + offset;
+			stable_sort (reference.begin(), reference.end(), [&](size_t x, size_t y){
+				return make_tuple (CmpColumn (ca[x], ca[y], oa), CmpColumn (cb[x], cb[y], ob), CmpColumn (cc[x], cc[y], oc)) < make_tuple (0, 0, 0);
+			});
+
+			// Compare the row orders
+			for (size_t k = 0; k < count; k++) {
+				if (rows[k] != reference[k]) {
+					throw runtime_error ("    Mismatch of the row at [" + to_string (k) +
+					"]: Got '" + to_string (rows[k]) + "' Expected '" + to_string (reference[k]) + "'");
+				}
+			}
+		}
+	}
+}
+
+//****************************************************************************//
+//      Unit test routines                                                    //
+//****************************************************************************//
+void TestMultiColumnSort (void) {
+
+	// Show the stage info
+	StageInfo ("MultiColumnSort::Sort", BUFFER_SIZE, ROUNDS, TRIES);
+
+	// Mixed column types and orders with both key sorts
+	for (MultiColumnSort::Algorithm algorithm : {MultiColumnSort::RADIX, MultiColumnSort::MERGE}) {
+		TestMultiColumnSort <uint8_t, uint8_t, uint8_t> (MultiColumnSort::ASC, MultiColumnSort::ASC, MultiColumnSort::ASC, algorithm);
+		TestMultiColumnSort <uint8_t, flt64_t, sint32_t> (MultiColumnSort::ASC, MultiColumnSort::DSC, MultiColumnSort::ASC, algorithm);
+		TestMultiColumnSort <sint16_t, uint64_t, flt32_t> (MultiColumnSort::DSC, MultiColumnSort::ASC, MultiColumnSort::DSC, algorithm);
+		TestMultiColumnSort <sint64_t, sint8_t, uint32_t> (MultiColumnSort::DSC, MultiColumnSort::DSC, MultiColumnSort::DSC, algorithm);
+	}
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
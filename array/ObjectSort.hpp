@@ -0,0 +1,184 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#               UNIT TESTS FOR THE OBJECT SORT BY EXTRACTED KEYS               #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	"../ext/ObjectSort.hpp"
+
+//****************************************************************************//
+//      Key of an object array made of keys (see KeyCmp)                      //
+//****************************************************************************//
+sint64_t KeyOf (const void *key) {
+	return reinterpret_cast <const size_t> (key);
+}
+
+//****************************************************************************//
+//      Record reached through an object pointer                              //
+//****************************************************************************//
+struct Record
+{
+	sint32_t	major;			// Most significant field of the record
+	flt64_t		minor;			// Least significant field of the record
+};
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Key of a record (the most significant field only)                     //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+sint32_t RecordKey (const void *record) {
+	return reinterpret_cast <const Record*> (record)->major;
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Compare function for records                                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+sint64_t RecordCmp (const void *record1, const void *record2) {
+	const Record *rec1 = reinterpret_cast <const Record*> (record1);
+	const Record *rec2 = reinterpret_cast <const Record*> (record2);
+	if (rec1->major != rec2->major)
+		return (rec1->major > rec2->major) - (rec1->major < rec2->major);
+	return (rec1->minor > rec2->minor) - (rec1->minor < rec2->minor);
+}
+
+//****************************************************************************//
+//      Test function for object arrays made of keys                          //
+//****************************************************************************//
+void TestObjectSort (
+	void (*func)(const void* array[], const void* temp[], size_t size, sint64_t (*key)(const void*), Cmp func),
+	void (*ref)(sint64_t target[], size_t size)
+){
+	// Create arrays of the target size
+	RandomArray <sint64_t> array (BUFFER_SIZE, SEED, MAX_VALUE);
+	RandomArray <sint64_t> temp (BUFFER_SIZE, SEED, MAX_VALUE);
+
+	// Run the test in many rounds with a random offset and element count
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random offset inside the array and a random number of elements
+		// to work with
+		size_t offset = array.Offset ();
+		size_t count = array.Count (offset);
+
+		// Do many tries with the same offset and element count, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Check with and without the tie breaking callback
+			for (Cmp cmp : {static_cast <Cmp> (nullptr), KeyCmp}) {
+
+				// Populate the array with random data
+				array.Populate ();
+
+				// Make a copy for the reference implementation of the function
+				RandomArray <sint64_t> reference (array);
+
+				// Apply the operation to the array data. Both the testing and the reference
+				func (reinterpret_cast <const void**> (array.Data() + offset), reinterpret_cast <const void**> (temp.Data() + offset), count, KeyOf, cmp);
+				ref (reference.Data() + offset, count);
+
+				// Compare arrays for different elements
+				array.Compare (reference, EPSILON);
+			}
+		}
+	}
+}
+
+//****************************************************************************//
+//      Test function for pointers to records                                 //
+//****************************************************************************//
+void TestObjectSortRecords (
+	void (*func)(const void* array[], const void* temp[], size_t size, sint32_t (*key)(const void*), Cmp func),
+	bool ascending
+){
+	// Create the record fields of the target size
+	RandomArray <sint32_t> major (BUFFER_SIZE, SEED, MAX_VALUE);
+	RandomArray <flt64_t> minor (BUFFER_SIZE, SEED + 1, MAX_VALUE);
+	vector <Record> records (BUFFER_SIZE);
+	vector <const void*> array (BUFFER_SIZE), temp (BUFFER_SIZE);
+	mt19937_64 generator (SEED);
+
+	// Run the test in many rounds with a random offset and element count
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random offset inside the array and a random number of elements
+		// to work with
+		size_t offset = major.Offset ();
+		size_t count = major.Count (offset);
+
+		// Do many tries with the same offset and element count, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the records with random data and point to them in a
+			// random order
+			major.Populate ();
+			minor.Populate ();
+			for (size_t k = 0; k < BUFFER_SIZE; k++) {
+				records[k].major = major.Data()[k];
+				records[k].minor = minor.Data()[k];
+				array[k] = &records[k];
+			}
+			shuffle (array.begin(), array.end(), generator);
+
+			// Stable sort of the record pointers by the compare function
+			vector <const void*> reference (array.begin() + offset, array.begin() + offset + count);
+			stable_sort (reference.begin(), reference.end(), [ascending](const void *a, const void *b){
+				return ascending ? RecordCmp (a, b) < 0 : RecordCmp (a, b) > 0;
+			});
+
+			// Apply the operation to the array data
+			func (array.data() + offset, temp.data() + offset, count, RecordKey, RecordCmp);
+
+			// Compare the record orders
+			for (size_t k = 0; k < count; k++) {
+				if (array[offset + k] != reference[k]) {
+					const Record *rec = reinterpret_cast <const Record*> (array[offset + k]);
+					throw runtime_error ("    Mismatch of the record at [" + to_string (k) +
+					"]: Got '" + to_string (rec->major) + ", " + to_string (rec->minor) + "'");
+				}
+			}
+		}
+	}
+}
+
+//****************************************************************************//
+//      Unit test routines                                                    //
+//****************************************************************************//
+
+//============================================================================//
+//      Object arrays made of keys                                            //
+//============================================================================//
+# define	OBJECT_SORT(func,ref)												\
+void TestObject##func (void) {													\
+	StageInfo ("ObjectSort::" # func, BUFFER_SIZE, ROUNDS, TRIES);				\
+	TestObjectSort (ObjectSort::func <decltype (&KeyOf)>, ref);					\
+}
+
+// Ascending sort order
+OBJECT_SORT (SortAsc, QuickSortAsc)
+
+// Descending sort order
+OBJECT_SORT (SortDsc, QuickSortDsc)
+
+//============================================================================//
+//      Pointers to records                                                   //
+//============================================================================//
+# define	OBJECT_SORT_RECORDS(func,order)										\
+void TestRecord##func (void) {													\
+	StageInfo ("ObjectSort::" # func " (records)", BUFFER_SIZE, ROUNDS, TRIES);	\
+	TestObjectSortRecords (ObjectSort::func <decltype (&RecordKey)>, order);	\
+}
+
+// Ascending sort order
+OBJECT_SORT_RECORDS (SortAsc, true)
+
+// Descending sort order
+OBJECT_SORT_RECORDS (SortDsc, false)
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,349 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                    UNIT TESTS FOR THE PARALLEL REDUCTIONS                    #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<memory>
+# include	<cstring>
+# include	"../ext/ParallelReduce.hpp"
+
+//****************************************************************************//
+//      Test a parallel reduction with no arguments                           //
+//****************************************************************************//
+template <typename R, typename T>
+void TestParallelFunc0 (
+	ThreadPool &pool,
+	R (*func)(ThreadPool &pool, const T target[], size_t size),
+	R (*ref)(const T target[], size_t size)
+){
+	// Create an array of the target size
+	RandomArray <T> array (BUFFER_SIZE, SEED, MAX_VALUE);
+
+	// Run the test in many rounds with a random offset and element count
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random offset inside the array and a random number of elements
+		// to work with
+		size_t offset = array.Offset ();
+		size_t count = array.Count (offset);
+
+		// Do many tries with the same offset and element count, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the array with random data
+			array.Populate ();
+
+			// Make a copy for the reference implementation of the function
+			RandomArray <T> reference (array);
+
+			// Apply the operation to the array data. Both the testing and the reference
+			R computed_value = func (pool, array.Data() + offset, count);
+			R correct_value = ref (reference.Data() + offset, count);
+
+			// Compare the result values
+			array.CheckResult (computed_value, correct_value, EPSILON);
+		}
+	}
+}
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+template <typename T>
+void TestParallelFunc0 (
+	ThreadPool &pool,
+	T (*func)(ThreadPool &pool, const T target[], const T source[], size_t size),
+	T (*ref)(const T target[], const T source[], size_t size)
+){
+	// Create arrays of the target size
+	RandomArray <T> target (BUFFER_SIZE, SEED, MAX_VALUE);
+	RandomArray <T> source (BUFFER_SIZE, SEED, MAX_VALUE);
+
+	// Run the test in many rounds with a random offset and element count
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random offset inside the arrays and a random number of elements
+		// to work with
+		size_t toffset = target.Offset ();
+		size_t soffset = source.Offset ();
+		size_t tcount = target.Count (toffset);
+		size_t scount = source.Count (soffset);
+		size_t count = min (tcount, scount);
+
+		// Do many tries with the same offset and element count, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate both arrays with random data
+			target.Populate ();
+			source.Populate ();
+
+			// Make a copy for the reference implementation of the function
+			RandomArray <T> treference (target);
+			RandomArray <T> sreference (source);
+
+			// Apply the operation to the array data. Both the testing and the reference
+			T computed_value = func (pool, target.Data() + toffset, source.Data() + soffset, count);
+			T correct_value = ref (treference.Data() + toffset, sreference.Data() + soffset, count);
+
+			// Compare the result values
+			target.CheckResult (computed_value, correct_value, EPSILON);
+		}
+	}
+}
+
+//****************************************************************************//
+//      Test the parallel min and max function                                //
+//****************************************************************************//
+template <typename T>
+void TestParallelMinMax (
+	ThreadPool &pool,
+	void (*func)(ThreadPool &pool, const T target[], size_t size, T &min, T &max),
+	void (*ref)(const T target[], size_t size, T &min, T &max)
+){
+	// Create an array of the target size
+	RandomArray <T> array (BUFFER_SIZE, SEED, MAX_VALUE);
+
+	// Run the test in many rounds with a random offset and element count
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random offset inside the array and a random number of elements
+		// to work with
+		size_t offset = array.Offset ();
+		size_t count = array.Count (offset);
+
+		// Do many tries with the same offset and element count, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the array with random data
+			array.Populate ();
+
+			// Make a copy for the reference implementation of the function
+			RandomArray <T> reference (array);
+
+			// Apply the operation to the array data. Both the testing and the reference
+			T computed_min, computed_max;
+			T correct_min, correct_max;
+			func (pool, array.Data() + offset, count, computed_min, computed_max);
+			ref (reference.Data() + offset, count, correct_min, correct_max);
+
+			// Compare the min and max values
+			array.CheckResult (computed_min, correct_min, EPSILON);
+			array.CheckResult (computed_max, correct_max, EPSILON);
+		}
+	}
+}
+
+//****************************************************************************//
+//      Test a reproducible sum for bitwise identical results                 //
+//****************************************************************************//
+template <typename T>
+void TestReproducible (
+	T (*func)(ThreadPool &pool, const T target[], size_t size),
+	T (*ref)(const T target[], size_t size)
+){
+	// Create an array of the target size and the pools of different size
+	RandomArray <T> array (BUFFER_SIZE, SEED, MAX_VALUE);
+	vector <unique_ptr <ThreadPool>> pools;
+	for (size_t threads = 1; threads <= 8; threads++)
+		pools.emplace_back (new ThreadPool (threads));
+
+	// Run the test in many rounds with a random offset and element count
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random offset inside the array and a random number of elements
+		// to work with
+		size_t offset = array.Offset ();
+		size_t count = array.Count (offset);
+
+		// Do many tries with the same offset and element count, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the array with random data. Values with a fractional
+			// part make the rounding depend on the order of additions
+			array.Populate ();
+			for (size_t k = 0; k < BUFFER_SIZE; k++)
+				array.Data()[k] /= 3;
+
+			// The result should be close to the reference one
+			T expected = func (*pools[0], array.Data() + offset, count);
+			array.CheckResult (expected, ref (array.Data() + offset, count), EPSILON);
+
+			// All the thread counts should give the same bits
+			for (size_t k = 1; k < pools.size(); k++) {
+				T computed = func (*pools[k], array.Data() + offset, count);
+				if (memcmp (&computed, &expected, sizeof (T))) {
+					throw runtime_error ("    Mismatch of the " + to_string (k + 1) +
+					" threads sum: Got '" + to_string (computed) + "' Expected '" +
+					to_string (expected) + "'");
+				}
+			}
+		}
+	}
+}
+
+//****************************************************************************//
+//      Unit test routines                                                    //
+//****************************************************************************//
+
+//============================================================================//
+//      Parallel sum of values                                                //
+//============================================================================//
+void TestParallelSum (void) {
+
+	// Show the stage info
+	StageInfo ("ParallelReduce::Sum", BUFFER_SIZE, ROUNDS, TRIES);
+
+	// Floating-point types
+	for (size_t threads : THREAD_COUNTS) {
+		ThreadPool pool (threads);
+		TestParallelFunc0 <flt32_t, flt32_t> (pool, ParallelReduce::Sum, Sum);
+		TestParallelFunc0 <flt64_t, flt64_t> (pool, ParallelReduce::Sum, Sum);
+	}
+}
+
+//============================================================================//
+//      Parallel sum of squared values                                        //
+//============================================================================//
+void TestParallelSumSqr (void) {
+
+	// Show the stage info
+	StageInfo ("ParallelReduce::SumSqr", BUFFER_SIZE, ROUNDS, TRIES);
+
+	// Floating-point types
+	for (size_t threads : THREAD_COUNTS) {
+		ThreadPool pool (threads);
+		TestParallelFunc0 <flt32_t, flt32_t> (pool, ParallelReduce::SumSqr, SumSqr);
+		TestParallelFunc0 <flt64_t, flt64_t> (pool, ParallelReduce::SumSqr, SumSqr);
+	}
+}
+
+//============================================================================//
+//      Parallel sum of multiplied values                                     //
+//============================================================================//
+void TestParallelSumMul (void) {
+
+	// Show the stage info
+	StageInfo ("ParallelReduce::SumMul", BUFFER_SIZE, ROUNDS, TRIES);
+
+	// Floating-point types
+	for (size_t threads : THREAD_COUNTS) {
+		ThreadPool pool (threads);
+		TestParallelFunc0 <flt32_t> (pool, ParallelReduce::SumMul, SumMul);
+		TestParallelFunc0 <flt64_t> (pool, ParallelReduce::SumMul, SumMul);
+	}
+}
+
+//============================================================================//
+//      Reproducible sum of values                                            //
+//============================================================================//
+void TestReproducibleSum (void) {
+
+	// Show the stage info
+	StageInfo ("ParallelReduce::ReproducibleSum", BUFFER_SIZE, ROUNDS, TRIES);
+
+	// Floating-point types
+	TestReproducible <flt32_t> (ParallelReduce::ReproducibleSum, Sum);
+	TestReproducible <flt64_t> (ParallelReduce::ReproducibleSum, Sum);
+}
+
+//============================================================================//
+//      Reproducible sum of squared values                                    //
+//============================================================================//
+void TestReproducibleSumSqr (void) {
+
+	// Show the stage info
+	StageInfo ("ParallelReduce::ReproducibleSumSqr", BUFFER_SIZE, ROUNDS, TRIES);
+
+	// Floating-point types
+	TestReproducible <flt32_t> (ParallelReduce::ReproducibleSumSqr, SumSqr);
+	TestReproducible <flt64_t> (ParallelReduce::ReproducibleSumSqr, SumSqr);
+}
+
+//============================================================================//
+//      Parallel minimum value                                                //
+//============================================================================//
+void TestParallelMin (void) {
+
+	// Show the stage info
+	StageInfo ("ParallelReduce::Min", BUFFER_SIZE, ROUNDS, TRIES);
+
+	for (size_t threads : THREAD_COUNTS) {
+		ThreadPool pool (threads);
+
+		// Unsigned integer types
+		TestParallelFunc0 <uint8_t, uint8_t> (pool, ParallelReduce::Min, Min);
+		TestParallelFunc0 <uint16_t, uint16_t> (pool, ParallelReduce::Min, Min);
+		TestParallelFunc0 <uint32_t, uint32_t> (pool, ParallelReduce::Min, Min);
+
+		// Signed integer types
+		TestParallelFunc0 <sint8_t, sint8_t> (pool, ParallelReduce::Min, Min);
+		TestParallelFunc0 <sint16_t, sint16_t> (pool, ParallelReduce::Min, Min);
+		TestParallelFunc0 <sint32_t, sint32_t> (pool, ParallelReduce::Min, Min);
+
+		// Floating-point types
+		TestParallelFunc0 <flt32_t, flt32_t> (pool, ParallelReduce::Min, Min);
+		TestParallelFunc0 <flt64_t, flt64_t> (pool, ParallelReduce::Min, Min);
+	}
+}
+
+//============================================================================//
+//      Parallel maximum value                                                //
+//============================================================================//
+void TestParallelMax (void) {
+
+	// Show the stage info
+	StageInfo ("ParallelReduce::Max", BUFFER_SIZE, ROUNDS, TRIES);
+
+	for (size_t threads : THREAD_COUNTS) {
+		ThreadPool pool (threads);
+
+		// Unsigned integer types
+		TestParallelFunc0 <uint8_t, uint8_t> (pool, ParallelReduce::Max, Max);
+		TestParallelFunc0 <uint16_t, uint16_t> (pool, ParallelReduce::Max, Max);
+		TestParallelFunc0 <uint32_t, uint32_t> (pool, ParallelReduce::Max, Max);
+
+		// Signed integer types
+		TestParallelFunc0 <sint8_t, sint8_t> (pool, ParallelReduce::Max, Max);
+		TestParallelFunc0 <sint16_t, sint16_t> (pool, ParallelReduce::Max, Max);
+		TestParallelFunc0 <sint32_t, sint32_t> (pool, ParallelReduce::Max, Max);
+
+		// Floating-point types
+		TestParallelFunc0 <flt32_t, flt32_t> (pool, ParallelReduce::Max, Max);
+		TestParallelFunc0 <flt64_t, flt64_t> (pool, ParallelReduce::Max, Max);
+	}
+}
+
+//============================================================================//
+//      Parallel minimum and maximum values                                   //
+//============================================================================//
+void TestParallelMinMax (void) {
+
+	// Show the stage info
+	StageInfo ("ParallelReduce::MinMax", BUFFER_SIZE, ROUNDS, TRIES);
+
+	for (size_t threads : THREAD_COUNTS) {
+		ThreadPool pool (threads);
+
+		// Unsigned integer types
+		TestParallelMinMax <uint8_t> (pool, ParallelReduce::MinMax, MinMax);
+		TestParallelMinMax <uint16_t> (pool, ParallelReduce::MinMax, MinMax);
+		TestParallelMinMax <uint32_t> (pool, ParallelReduce::MinMax, MinMax);
+
+		// Signed integer types
+		TestParallelMinMax <sint8_t> (pool, ParallelReduce::MinMax, MinMax);
+		TestParallelMinMax <sint16_t> (pool, ParallelReduce::MinMax, MinMax);
+		TestParallelMinMax <sint32_t> (pool, ParallelReduce::MinMax, MinMax);
+
+		// Floating-point types
+		TestParallelMinMax <flt32_t> (pool, ParallelReduce::MinMax, MinMax);
+		TestParallelMinMax <flt64_t> (pool, ParallelReduce::MinMax, MinMax);
+	}
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,166 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                       UNIT TESTS FOR THE PARALLEL SORT                       #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	"../ext/ParallelSort.hpp"
+
+//****************************************************************************//
+//      Test function for parallel array sorting                              //
+//****************************************************************************//
+template <typename T>
+void TestParallelSort (
+	ThreadPool &pool,
+	void (*func)(ThreadPool &pool, T array[], T temp[], size_t size),
+	void (*ref)(T array[], size_t size)
+){
+	// Create an array of the target size
+	RandomArray <T> array (BUFFER_SIZE, SEED, MAX_VALUE);
+
+	// Run the test in many rounds with a random offset and element count
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random offset inside the array and a random number of elements
+		// to work with
+		size_t offset = array.Offset ();
+		size_t count = array.Count (offset);
+
+		// Do many tries with the same offset and element count, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the array with random data
+			array.Populate ();
+
+			// Make a copy for the reference implementation of the function
+			RandomArray <T> reference (array);
+
+			// Create a temporary array needed for the sort
+			RandomArray <T> temp (BUFFER_SIZE, SEED, MAX_VALUE);
+
+			// Apply the operation to the array data. Both the testing and the reference
+			func (pool, array.Data() + offset, temp.Data() + offset, count);
+			ref (reference.Data() + offset, count);
+
+			// Compare arrays for different elements
+			array.Compare (reference, EPSILON);
+		}
+	}
+}
+
+//****************************************************************************//
+//      Test function for parallel key array sorting                          //
+//****************************************************************************//
+template <typename T>
+void TestParallelSortKey (
+	ThreadPool &pool,
+	void (*func)(ThreadPool &pool, T key[], const void* ptr[], T tkey[], const void* tptr[], size_t size),
+	void (*ref)(T array[], size_t size)
+){
+	// Create an array of the target size
+	RandomArray <T> array (BUFFER_SIZE, SEED, MAX_VALUE);
+
+	// Run the test in many rounds with a random offset and element count
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random offset inside the array and a random number of elements
+		// to work with
+		size_t offset = array.Offset ();
+		size_t count = array.Count (offset);
+
+		// Do many tries with the same offset and element count, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the array with random data
+			array.Populate ();
+
+			// Make a copy for the reference implementation of the function
+			RandomArray <T> reference (array);
+
+			// Create temporary arrays needed for the sort
+			RandomArray <T> temp (BUFFER_SIZE, SEED, MAX_VALUE);
+			RandomArray <size_t> ptr (array);
+			RandomArray <size_t> tptr (BUFFER_SIZE, SEED, MAX_VALUE);
+
+			// Apply the operation to the array data. Both the testing and the reference
+			func (pool, array.Data() + offset, reinterpret_cast <const void**> (ptr.Data() + offset), temp.Data(), reinterpret_cast <const void**> (tptr.Data()), count);
+			ref (reference.Data() + offset, count);
+
+			// Compare arrays for different elements
+			array.Compare (reference, EPSILON);
+
+			// Check the connection between keys and values
+			ptr.CheckValues (array);
+		}
+	}
+}
+
+//****************************************************************************//
+//      Unit test routines                                                    //
+//****************************************************************************//
+
+//============================================================================//
+//      Regular array sorting                                                 //
+//============================================================================//
+# define	PARALLEL_SORT_ARRAY(func,ref)										\
+void TestParallel##func (void) {												\
+	StageInfo ("ParallelSort::" # func, BUFFER_SIZE, ROUNDS, TRIES);			\
+	for (size_t threads : THREAD_COUNTS) {										\
+		ThreadPool pool (threads);												\
+		TestParallelSort <uint8_t> (pool, ParallelSort::func, ref);				\
+		TestParallelSort <uint16_t> (pool, ParallelSort::func, ref);			\
+		TestParallelSort <uint32_t> (pool, ParallelSort::func, ref);			\
+		TestParallelSort <uint64_t> (pool, ParallelSort::func, ref);			\
+		TestParallelSort <sint8_t> (pool, ParallelSort::func, ref);				\
+		TestParallelSort <sint16_t> (pool, ParallelSort::func, ref);			\
+		TestParallelSort <sint32_t> (pool, ParallelSort::func, ref);			\
+		TestParallelSort <sint64_t> (pool, ParallelSort::func, ref);			\
+		TestParallelSort <flt32_t> (pool, ParallelSort::func, ref);				\
+		TestParallelSort <flt64_t> (pool, ParallelSort::func, ref);				\
+		TestParallelSort <size_t> (pool, ParallelSort::func, ref);				\
+	}																			\
+}
+
+// Ascending sort order
+PARALLEL_SORT_ARRAY (SortAsc, RadixSortAsc)
+
+// Descending sort order
+PARALLEL_SORT_ARRAY (SortDsc, RadixSortDsc)
+
+//============================================================================//
+//      Key array sorting                                                     //
+//============================================================================//
+# define	PARALLEL_SORT_KEY(func,ref)											\
+void TestParallel##func (void) {												\
+	StageInfo ("ParallelSort::" # func, BUFFER_SIZE, ROUNDS, TRIES);			\
+	for (size_t threads : THREAD_COUNTS) {										\
+		ThreadPool pool (threads);												\
+		TestParallelSortKey <uint8_t> (pool, ParallelSort::func, ref);			\
+		TestParallelSortKey <uint16_t> (pool, ParallelSort::func, ref);			\
+		TestParallelSortKey <uint32_t> (pool, ParallelSort::func, ref);			\
+		TestParallelSortKey <uint64_t> (pool, ParallelSort::func, ref);			\
+		TestParallelSortKey <sint8_t> (pool, ParallelSort::func, ref);			\
+		TestParallelSortKey <sint16_t> (pool, ParallelSort::func, ref);			\
+		TestParallelSortKey <sint32_t> (pool, ParallelSort::func, ref);			\
+		TestParallelSortKey <sint64_t> (pool, ParallelSort::func, ref);			\
+		TestParallelSortKey <flt32_t> (pool, ParallelSort::func, ref);			\
+		TestParallelSortKey <flt64_t> (pool, ParallelSort::func, ref);			\
+		TestParallelSortKey <size_t> (pool, ParallelSort::func, ref);			\
+	}																			\
+}
+
+// Ascending sort order
+PARALLEL_SORT_KEY (SortKeyAsc, RadixSortAsc)
+
+// Descending sort order
+PARALLEL_SORT_KEY (SortKeyDsc, RadixSortDsc)
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,187 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                     UNIT TESTS FOR THE SORT PERMUTATIONS                     #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<numeric>
+# include	"../ext/Permutation.hpp"
+
+//****************************************************************************//
+//      Test function for the sort permutation                                //
+//****************************************************************************//
+template <typename T>
+void TestArgsort (
+	void (*func)(size_t index[], const T key[], size_t size),
+	bool (*cmp)(T a, T b)
+){
+	// Create an array of the target size
+	RandomArray <T> array (BUFFER_SIZE, SEED, MAX_VALUE);
+
+	// Run the test in many rounds with a random offset and element count
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random offset inside the array and a random number of elements
+		// to work with
+		size_t offset = array.Offset ();
+		size_t count = array.Count (offset);
+
+		// Do many tries with the same offset and element count, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the array with random data
+			array.Populate ();
+
+			// Make a copy to check that the keys are left as they are
+			RandomArray <T> reference (array);
+
+			// Apply the operation to the array data
+			vector <size_t> index (count);
+			func (index.data(), array.Data() + offset, count);
+
+			// Stable sort of the indices by the keys
+			const T *key = array.Data() + offset;
+			vector <size_t> correct (count);
+			iota (correct.begin(), correct.end(), 0);
+			stable_sort (correct.begin(), correct.end(), [&](size_t a, size_t b){
+				return cmp (key[a], key[b]);
+			});
+
+			// Compare the permutations
+			for (size_t k = 0; k < count; k++) {
+				if (index[k] != correct[k]) {
+					throw runtime_error ("    Mismatch of the index at [" + to_string (k) +
+					"]: Got '" + to_string (index[k]) + "' Expected '" + to_string (correct[k]) + "'");
+				}
+			}
+
+			// The keys should be left as they are
+			array.Compare (reference, EPSILON);
+		}
+	}
+}
+
+//****************************************************************************//
+//      Test function for the permutation apply                               //
+//****************************************************************************//
+template <typename T>
+void TestGather (
+	void (*func)(T target[], const T source[], const size_t index[], size_t size)
+){
+	// Create arrays of the target size
+	RandomArray <T> target (BUFFER_SIZE, SEED, MAX_VALUE);
+	RandomArray <T> source (BUFFER_SIZE, SEED, MAX_VALUE);
+	mt19937_64 generator (SEED);
+
+	// Run the test in many rounds with a random offset and element count
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random offset inside the arrays and a random number of elements
+		// to work with
+		size_t offset = target.Offset ();
+		size_t count = target.Count (offset);
+
+		// Do many tries with the same offset and element count, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate both arrays with random data
+			target.Populate ();
+			source.Populate ();
+
+			// Make a copy for the reference implementation of the function
+			RandomArray <T> reference (target);
+
+			// Random permutation of the source elements
+			vector <size_t> index (count);
+			iota (index.begin(), index.end(), 0);
+			shuffle (index.begin(), index.end(), generator);
+
+			// Apply the operation to the array data. Both the testing and the reference
+			func (target.Data() + offset, source.Data(), index.data(), count);
+			for (size_t k = 0; k < count; k++)
+				reference.Data()[offset + k] = source.Data()[index[k]];
+
+			// Compare arrays for different elements
+			target.CheckValues (reference);
+		}
+	}
+}
+
+//****************************************************************************//
+//      Order of the reference sorts                                          //
+//****************************************************************************//
+template <typename T>
+bool LessAsc (T a, T b) {
+	return a < b;
+}
+template <typename T>
+bool LessDsc (T a, T b) {
+	return a > b;
+}
+
+//****************************************************************************//
+//      Unit test routines                                                    //
+//****************************************************************************//
+
+//============================================================================//
+//      Sort permutation                                                      //
+//============================================================================//
+# define	ARGSORT(func,cmp)													\
+void Test##func (void) {														\
+	StageInfo ("Permutation::" # func, BUFFER_SIZE, ROUNDS, TRIES);				\
+	TestArgsort <uint8_t> (Permutation::func, cmp);								\
+	TestArgsort <uint16_t> (Permutation::func, cmp);							\
+	TestArgsort <uint32_t> (Permutation::func, cmp);							\
+	TestArgsort <uint64_t> (Permutation::func, cmp);							\
+	TestArgsort <sint8_t> (Permutation::func, cmp);								\
+	TestArgsort <sint16_t> (Permutation::func, cmp);							\
+	TestArgsort <sint32_t> (Permutation::func, cmp);							\
+	TestArgsort <sint64_t> (Permutation::func, cmp);							\
+	TestArgsort <flt32_t> (Permutation::func, cmp);								\
+	TestArgsort <flt64_t> (Permutation::func, cmp);								\
+	TestArgsort <size_t> (Permutation::func, cmp);								\
+}
+
+// Ascending sort order
+ARGSORT (ArgsortAsc, LessAsc)
+
+// Descending sort order
+ARGSORT (ArgsortDsc, LessDsc)
+
+//============================================================================//
+//      Permutation apply                                                     //
+//============================================================================//
+void TestGather (void) {
+
+	// Show the stage info
+	StageInfo ("Permutation::Gather", BUFFER_SIZE, ROUNDS, TRIES);
+
+	// Unsigned integer types
+	TestGather <uint8_t> (Permutation::Gather);
+	TestGather <uint16_t> (Permutation::Gather);
+	TestGather <uint32_t> (Permutation::Gather);
+	TestGather <uint64_t> (Permutation::Gather);
+
+	// Signed integer types
+	TestGather <sint8_t> (Permutation::Gather);
+	TestGather <sint16_t> (Permutation::Gather);
+	TestGather <sint32_t> (Permutation::Gather);
+	TestGather <sint64_t> (Permutation::Gather);
+
+	// Floating-point types
+	TestGather <flt32_t> (Permutation::Gather);
+	TestGather <flt64_t> (Permutation::Gather);
+
+	// Other types
+	TestGather <size_t> (Permutation::Gather);
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,154 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                      UNIT TESTS FOR THE RADIX PARTITION                      #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<bit>
+# include	<cstring>
+# include	"../ext/RadixPartition.hpp"
+
+# define	RP_MIN_CHUNK	64		// Min count of keys per thread (all the threads get chunks)
+
+//****************************************************************************//
+//      Naive partition                                                       //
+//****************************************************************************//
+// Appends each key to the list of its partition, and joins the lists
+template <typename T>
+void Partition (
+	T target[],					// Target array of keys
+	size_t index[],				// Target array of the key positions
+	const T key[],				// Array of keys
+	size_t size,				// Count of keys
+	size_t bits,				// Count of bits of the digit
+	size_t shift,				// Position of the digit
+	size_t bounds[]				// Target array of the partition bounds
+){
+	typedef make_unsigned_t <conditional_t <is_floating_point_v <T>,
+		conditional_t <sizeof (T) == 4, sint32_t, sint64_t>, T>> U;
+	const size_t width = 8 * sizeof (T);
+	vector <vector <size_t>> lists (size_t (1) << bits);
+	for (size_t i = 0; i < size; i++) {
+
+		// Order the bits like the numbers: the negative ones first
+		U value = bit_cast <U> (key[i]);
+		const bool negative = is_floating_point_v <T> || is_signed_v <T> ? value >> (width - 1) : false;
+		if (is_floating_point_v <T> && negative)
+			value = ~value;
+		else if (is_floating_point_v <T> || is_signed_v <T>)
+			value ^= U (1) << (width - 1);
+		const size_t digit = shift < width ? (value >> shift) % lists.size() : 0;
+		lists[digit].push_back (i);
+	}
+	size_t k = 0;
+	for (size_t p = 0; p < lists.size(); p++) {
+		bounds[p] = k;
+		for (size_t i : lists[p]) {
+			target[k] = key[i];
+			index[k++] = i;
+		}
+	}
+	bounds[lists.size()] = k;
+}
+
+//****************************************************************************//
+//      Test function for the radix partition                                 //
+//****************************************************************************//
+template <typename T>
+void TestRadixPartition (ThreadPool &pool, bool pointers) {
+
+	// Check keys of few and of many distinct values
+	for (T max : {T (MAX_VALUE), WideValue <T> ()}) {
+
+		// Create arrays of the target size
+		RandomArray <T> array (BUFFER_SIZE, SEED, max);
+		vector <T> target (BUFFER_SIZE), reference (BUFFER_SIZE);
+		vector <const void*> ptr (BUFFER_SIZE), ptarget (BUFFER_SIZE);
+		vector <size_t> index (BUFFER_SIZE), bounds (4097), ref_bounds (4097);
+		for (size_t k = 0; k < BUFFER_SIZE; k++)
+			ptr[k] = reinterpret_cast <const void*> (k);
+
+		// Run the test in many rounds with a random offset and element count
+		for (size_t i = 0; i < ROUNDS; i++) {
+
+			// Get a random offset inside the array and a random number of elements
+			// to work with
+			size_t offset = array.Offset ();
+			size_t count = array.Count (offset);
+
+			// Do many tries with the same offset and element count, but different data
+			for (size_t j = 0; j < TRIES; j++) {
+
+				// Populate the array with random data
+				array.Populate ();
+				const T *data = array.Data() + offset;
+
+				// Check digits of different widths in the low, the middle and the
+				// high bits of the keys. The target array is misaligned in some rounds.
+				// The small chunks split the array between all the threads, so the
+				// partial buffer lines of the threads meet inside the cache lines
+				const size_t bits = vector <size_t> {1, 4, 8, 12} [i % 4];
+				const size_t shift = vector <size_t> {0, 3, 8 * sizeof (T) - 1} [j % 3];
+				T *output = target.data() + i % 3;
+				const size_t size = min (count, BUFFER_SIZE - i % 3);
+
+				// Apply the operation to the array data. Both the testing and the reference
+				Partition (reference.data(), index.data(), data, size, bits, shift, ref_bounds.data());
+				if (pointers)
+					RadixPartition::PartitionKey (pool, output, ptarget.data(), data, ptr.data(), size, bits, shift, bounds.data(), RP_MIN_CHUNK);
+				else
+					RadixPartition::Partition (pool, output, data, size, bits, shift, bounds.data(), RP_MIN_CHUNK);
+
+				// Compare the bounds and the partitioned keys
+				for (size_t p = 0; p <= (size_t (1) << bits); p++)
+					array.CheckResult (bounds[p], ref_bounds[p], EPSILON);
+				for (size_t k = 0; k < size; k++) {
+					if (memcmp (&output[k], &reference[k], sizeof (T)))
+						throw runtime_error ("    Mismatch of the element at [" + to_string (k) +
+						"]: Got '" + to_string (output[k]) + "' Expected '" + to_string (reference[k]) + "'");
+					if (pointers && reinterpret_cast <size_t> (ptarget[k]) != index[k])
+						throw runtime_error ("    Mismatch of the pointer at [" + to_string (k) +
+						"]: Got '" + to_string (reinterpret_cast <size_t> (ptarget[k])) + "' Expected '" + to_string (index[k]) + "'");
+				}
+			}
+		}
+	}
+}
+
+//****************************************************************************//
+//      Unit test routines                                                    //
+//****************************************************************************//
+# define	RADIX_PARTITION(func,pointers)										\
+void TestRadix##func (void) {													\
+	StageInfo ("RadixPartition::" # func, BUFFER_SIZE, ROUNDS, TRIES);			\
+	for (size_t threads : THREAD_COUNTS) {										\
+		ThreadPool pool (threads);												\
+		TestRadixPartition <uint8_t> (pool, pointers);							\
+		TestRadixPartition <uint16_t> (pool, pointers);							\
+		TestRadixPartition <uint32_t> (pool, pointers);							\
+		TestRadixPartition <uint64_t> (pool, pointers);							\
+		TestRadixPartition <sint8_t> (pool, pointers);							\
+		TestRadixPartition <sint16_t> (pool, pointers);							\
+		TestRadixPartition <sint32_t> (pool, pointers);							\
+		TestRadixPartition <sint64_t> (pool, pointers);							\
+		TestRadixPartition <flt32_t> (pool, pointers);							\
+		TestRadixPartition <flt64_t> (pool, pointers);							\
+		TestRadixPartition <size_t> (pool, pointers);							\
+	}																			\
+}
+
+// Partition of keys
+RADIX_PARTITION (Partition, false)
+
+// Partition of keys with pointers
+RADIX_PARTITION (PartitionKey, true)
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
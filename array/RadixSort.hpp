@@ -166,6 +166,28 @@ RADIX_SORT_KEY (RadixSortKeyAsc, RadixSortAsc)
 // Descending sort order
 RADIX_SORT_KEY (RadixSortKeyDsc, RadixSortDsc)
 
+# define	RADIX_SORT_KEY_STABLE(func)											\
+void Test##func##Stable (void) {												\
+	StageInfo ("Array::" # func " (stability)", BUFFER_SIZE, ROUNDS, TRIES);	\
+	TestSortKeyStable <uint8_t> (Array::func);									\
+	TestSortKeyStable <uint16_t> (Array::func);									\
+	TestSortKeyStable <uint32_t> (Array::func);									\
+	TestSortKeyStable <uint64_t> (Array::func);									\
+	TestSortKeyStable <sint8_t> (Array::func);									\
+	TestSortKeyStable <sint16_t> (Array::func);									\
+	TestSortKeyStable <sint32_t> (Array::func);									\
+	TestSortKeyStable <sint64_t> (Array::func);									\
+	TestSortKeyStable <flt32_t> (Array::func);									\
+	TestSortKeyStable <flt64_t> (Array::func);									\
+	TestSortKeyStable <size_t> (Array::func);									\
+}
+
+// Ascending sort order
+RADIX_SORT_KEY_STABLE (RadixSortKeyAsc)
+
+// Descending sort order
+RADIX_SORT_KEY_STABLE (RadixSortKeyDsc)
+
 /*
 ################################################################################
 #                                 END OF FILE                                  #
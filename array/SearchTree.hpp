@@ -0,0 +1,103 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                    UNIT TESTS FOR THE STATIC SEARCH TREES                    #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<limits>
+# include	"../ext/SearchTree.hpp"
+
+//****************************************************************************//
+//      Test function for the search trees                                    //
+//****************************************************************************//
+template <typename T, typename F>
+void TestSearchTree (
+	F func,						// Search function of a tree
+	size_t (*ref)(const T target[], size_t size, T value)
+){
+	// Create an array of the target size
+	RandomArray <T> array (BUFFER_SIZE, SEED, MAX_VALUE);
+
+	// Run the test in many rounds with a random offset and element count
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random offset inside the array and a random number of elements
+		// to work with
+		size_t offset = array.Offset ();
+		size_t count = array.Count (offset);
+
+		// Do many tries with the same offset and element count, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the array with random data
+			array.Populate ();
+
+			// Sort the array in the ascending order
+			array.Sort (false);
+
+			// Build both trees
+			const T *data = array.Data() + offset;
+			const EytzingerTree <T> eytzinger (data, count);
+			const STree <T> stree (data, count);
+
+			// Search the values around the array range and the extremes of the type
+			vector <T> values {numeric_limits <T>::min(), numeric_limits <T>::max()};
+			for (T value = 0; value <= MAX_VALUE; value++) {
+				values.push_back (value);
+				if constexpr (is_signed_v <T>)
+					values.push_back (-value);
+			}
+			for (T value : values) {
+				const size_t correct_value = ref (data, count, value);
+				array.CheckResult (func (eytzinger, value), correct_value, EPSILON);
+				array.CheckResult (func (stree, value), correct_value, EPSILON);
+			}
+		}
+	}
+}
+
+//****************************************************************************//
+//      Unit test routines                                                    //
+//****************************************************************************//
+# define	SEARCH_TREE(func,ref)												\
+void TestSearchTree##func (void) {												\
+	StageInfo ("SearchTree::" # func, BUFFER_SIZE, ROUNDS, TRIES);				\
+	auto search = [](const auto &tree, auto value){ return tree.func (value); };\
+	TestSearchTree <uint8_t> (search, ref);										\
+	TestSearchTree <uint16_t> (search, ref);									\
+	TestSearchTree <uint32_t> (search, ref);									\
+	TestSearchTree <uint64_t> (search, ref);									\
+	TestSearchTree <sint8_t> (search, ref);										\
+	TestSearchTree <sint16_t> (search, ref);									\
+	TestSearchTree <sint32_t> (search, ref);									\
+	TestSearchTree <sint64_t> (search, ref);									\
+	TestSearchTree <size_t> (search, ref);										\
+}
+
+// Searching for the first equal element
+SEARCH_TREE (FindFirstEqual, FindFirstEqual)
+
+// Searching for the last equal element
+SEARCH_TREE (FindLastEqual, FindLastEqual)
+
+// Searching for a greater element
+SEARCH_TREE (FindGreat, FindGreatAsc)
+
+// Searching for a greater or equal element
+SEARCH_TREE (FindGreatOrEqual, FindGreatOrEqualAsc)
+
+// Searching for a less element
+SEARCH_TREE (FindLess, FindLessAsc)
+
+// Searching for a less or equal element
+SEARCH_TREE (FindLessOrEqual, FindLessOrEqualAsc)
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
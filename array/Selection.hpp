@@ -0,0 +1,264 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#               UNIT TESTS FOR THE SELECTION OF ORDER STATISTICS               #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	"../ext/Selection.hpp"
+
+//****************************************************************************//
+//      Test function for the n-th element selection                          //
+//****************************************************************************//
+template <typename T>
+void TestNthElement (void) {
+
+	// Check arrays with many and with few duplicates
+	for (T max : {T (MAX_VALUE), WideValue <T> ()}) {
+
+		// Create an array of the target size
+		RandomArray <T> array (BUFFER_SIZE, SEED, max);
+		mt19937_64 generator (SEED);
+
+		// Run the test in many rounds with a random offset and element count
+		for (size_t i = 0; i < ROUNDS; i++) {
+
+			// Get a random offset inside the array and a random number of elements
+			// to work with
+			size_t offset = array.Offset ();
+			size_t count = array.Count (offset);
+			if (count == 0)
+				continue;
+
+			// Do many tries with the same offset and element count, but different data
+			for (size_t j = 0; j < TRIES; j++) {
+
+				// Populate the array with random data
+				array.Populate ();
+
+				// Make a copy for the reference implementation of the function
+				RandomArray <T> reference (array);
+
+				// Apply the operation to the array data. Both the testing and the reference
+				T *data = array.Data() + offset;
+				T *ref = reference.Data() + offset;
+				const size_t n = j == 0 ? 0 : j == 1 ? count - 1 : generator () % count;
+				const T value = Selection::NthElement (data, count, n);
+				nth_element (ref, ref + n, ref + count);
+
+				// Compare the selected elements
+				if (value != ref[n] || data[n] != ref[n])
+					throw runtime_error ("    Mismatch of the element at [" + to_string (n) +
+					"]: Got '" + to_string (data[n]) + "' Expected '" + to_string (ref[n]) + "'");
+
+				// Check the split around the selected element
+				for (size_t k = 0; k < count; k++) {
+					if ((k < n && data[n] < data[k]) || (k > n && data[k] < data[n]))
+						throw runtime_error ("    Element at [" + to_string (k) +
+						"] is on the wrong side of the element at [" + to_string (n) + "]");
+				}
+
+				// The elements should be the same
+				sort (data, data + count);
+				sort (ref, ref + count);
+				array.Compare (reference, EPSILON);
+			}
+		}
+	}
+}
+
+//****************************************************************************//
+//      Test function for the top-k selection                                 //
+//****************************************************************************//
+template <typename T>
+void TestTopK (
+	void (*func)(T target[], const T array[], size_t size, size_t k),
+	bool ascending
+){
+	// Check arrays with many and with few duplicates
+	for (T max : {T (MAX_VALUE), WideValue <T> ()}) {
+
+		// Create arrays of the target size
+		RandomArray <T> array (BUFFER_SIZE, SEED, max);
+		RandomArray <T> target (BUFFER_SIZE, SEED, max);
+
+		// Run the test in many rounds with a random offset and element count
+		for (size_t i = 0; i < ROUNDS; i++) {
+
+			// Get a random offset inside the array and a random number of elements
+			// to work with
+			size_t offset = array.Offset ();
+			size_t count = array.Count (offset);
+
+			// Do many tries with the same offset and element count, but different data
+			for (size_t j = 0; j < TRIES; j++) {
+
+				// Populate the array with random data
+				array.Populate ();
+
+				// Fully sorted copy for the reference
+				vector <T> sorted (array.Data() + offset, array.Data() + offset + count);
+				if (ascending)
+					sort (sorted.begin(), sorted.end());
+				else
+					sort (sorted.begin(), sorted.end(), greater <T> ());
+
+				// Small and large counts of the selected elements
+				for (size_t k : {size_t (1), count / 100, count / 2, count}) {
+					func (target.Data(), array.Data() + offset, count, k);
+					for (size_t l = 0; l < min (k, count); l++) {
+						if (target.Data()[l] != sorted[l])
+							throw runtime_error ("    Mismatch of the top " + to_string (k) + " at [" + to_string (l) +
+							"]: Got '" + to_string (target.Data()[l]) + "' Expected '" + to_string (sorted[l]) + "'");
+					}
+				}
+			}
+		}
+	}
+}
+
+//****************************************************************************//
+//      Test function for the quantiles                                       //
+//****************************************************************************//
+template <typename T>
+void TestQuantiles (void) {
+
+	// Quantile levels in any order
+	const flt64_t levels[] = {0.5, 0.0, 0.1, 0.25, 0.9, 0.99, 1.0, 0.5, 0.75};
+	const size_t count_levels = sizeof (levels) / sizeof (levels[0]);
+	T target [count_levels];
+
+	// Check arrays with many and with few duplicates
+	for (T max : {T (MAX_VALUE), WideValue <T> ()}) {
+
+		// Create an array of the target size
+		RandomArray <T> array (BUFFER_SIZE, SEED, max);
+
+		// Run the test in many rounds with a random offset and element count
+		for (size_t i = 0; i < ROUNDS; i++) {
+
+			// Get a random offset inside the array and a random number of elements
+			// to work with
+			size_t offset = array.Offset ();
+			size_t count = array.Count (offset);
+			if (count == 0)
+				continue;
+
+			// Do many tries with the same offset and element count, but different data
+			for (size_t j = 0; j < TRIES; j++) {
+
+				// Populate the array with random data
+				array.Populate ();
+
+				// Fully sorted copy for the reference
+				vector <T> sorted (array.Data() + offset, array.Data() + offset + count);
+				sort (sorted.begin(), sorted.end());
+
+				// Apply the operation to the array data
+				Selection::Quantiles (target, array.Data() + offset, count, levels, count_levels);
+
+				// Compare the quantiles
+				for (size_t k = 0; k < count_levels; k++) {
+					const T correct = sorted[static_cast <size_t> (levels[k] * (count - 1))];
+					if (target[k] != correct)
+						throw runtime_error ("    Mismatch of the quantile " + to_string (levels[k]) +
+						": Got '" + to_string (target[k]) + "' Expected '" + to_string (correct) + "'");
+				}
+			}
+		}
+	}
+}
+
+//****************************************************************************//
+//      Unit test routines                                                    //
+//****************************************************************************//
+
+//============================================================================//
+//      N-th element                                                          //
+//============================================================================//
+void TestNthElement (void) {
+
+	// Show the stage info
+	StageInfo ("Selection::NthElement", BUFFER_SIZE, ROUNDS, TRIES);
+
+	// Unsigned integer types
+	TestNthElement <uint8_t> ();
+	TestNthElement <uint16_t> ();
+	TestNthElement <uint32_t> ();
+	TestNthElement <uint64_t> ();
+
+	// Signed integer types
+	TestNthElement <sint8_t> ();
+	TestNthElement <sint16_t> ();
+	TestNthElement <sint32_t> ();
+	TestNthElement <sint64_t> ();
+
+	// Floating-point types
+	TestNthElement <flt32_t> ();
+	TestNthElement <flt64_t> ();
+
+	// Other types
+	TestNthElement <size_t> ();
+}
+
+//============================================================================//
+//      Top-k elements                                                        //
+//============================================================================//
+# define	TOP_K(func,ascending)												\
+void Test##func (void) {														\
+	StageInfo ("Selection::" # func, BUFFER_SIZE, ROUNDS, TRIES);				\
+	TestTopK <uint8_t> (Selection::func, ascending);							\
+	TestTopK <uint16_t> (Selection::func, ascending);							\
+	TestTopK <uint32_t> (Selection::func, ascending);							\
+	TestTopK <uint64_t> (Selection::func, ascending);							\
+	TestTopK <sint8_t> (Selection::func, ascending);							\
+	TestTopK <sint16_t> (Selection::func, ascending);							\
+	TestTopK <sint32_t> (Selection::func, ascending);							\
+	TestTopK <sint64_t> (Selection::func, ascending);							\
+	TestTopK <flt32_t> (Selection::func, ascending);							\
+	TestTopK <flt64_t> (Selection::func, ascending);							\
+	TestTopK <size_t> (Selection::func, ascending);								\
+}
+
+// Smallest elements
+TOP_K (SmallestK, true)
+
+// Largest elements
+TOP_K (LargestK, false)
+
+//============================================================================//
+//      Quantiles                                                             //
+//============================================================================//
+void TestQuantiles (void) {
+
+	// Show the stage info
+	StageInfo ("Selection::Quantiles", BUFFER_SIZE, ROUNDS, TRIES);
+
+	// Unsigned integer types
+	TestQuantiles <uint8_t> ();
+	TestQuantiles <uint16_t> ();
+	TestQuantiles <uint32_t> ();
+	TestQuantiles <uint64_t> ();
+
+	// Signed integer types
+	TestQuantiles <sint8_t> ();
+	TestQuantiles <sint16_t> ();
+	TestQuantiles <sint32_t> ();
+	TestQuantiles <sint64_t> ();
+
+	// Floating-point types
+	TestQuantiles <flt32_t> ();
+	TestQuantiles <flt64_t> ();
+
+	// Other types
+	TestQuantiles <size_t> ();
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
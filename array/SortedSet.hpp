@@ -0,0 +1,214 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                 UNIT TESTS FOR THE OPERATIONS ON SORTED SETS                 #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	"../ext/SortedSet.hpp"
+
+//****************************************************************************//
+//      Sorted set of the random values                                       //
+//****************************************************************************//
+template <typename T>
+vector <T> MakeSet (const RandomArray <T> &array, size_t offset, size_t count) {
+	vector <T> set (array.Data() + offset, array.Data() + offset + count);
+	sort (set.begin(), set.end());
+	set.erase (unique (set.begin(), set.end()), set.end());
+	return set;
+}
+
+//****************************************************************************//
+//      Check the result of a set operation                                   //
+//****************************************************************************//
+template <typename T>
+void CheckSet (const T result[], size_t count, const vector <T> &correct) {
+	if (count != correct.size())
+		throw runtime_error ("    Mismatch of the result size: Got '" + to_string (count) +
+		"' Expected '" + to_string (correct.size()) + "'");
+	for (size_t k = 0; k < count; k++) {
+		if (result[k] != correct[k])
+			throw runtime_error ("    Mismatch of the element at [" + to_string (k) +
+			"]: Got '" + to_string (result[k]) + "' Expected '" + to_string (correct[k]) + "'");
+	}
+}
+
+//****************************************************************************//
+//      Test function for operations on two sets                              //
+//****************************************************************************//
+template <typename T>
+void TestSortedSet (
+	size_t (*func)(T target[], const T set1[], size_t size1, const T set2[], size_t size2, SortedSet::Path path),
+	T* (*ref)(const T* first1, const T* last1, const T* first2, const T* last2, T* target)
+){
+	// Create arrays of the target size
+	RandomArray <T> array1 (BUFFER_SIZE, SEED, SetRange <T> ());
+	RandomArray <T> array2 (BUFFER_SIZE, SEED + 1, SetRange <T> ());
+	vector <T> target (2 * BUFFER_SIZE);
+
+	// Run the test in many rounds with a random offset and element count
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get random offsets inside the arrays and random numbers of elements
+		// to work with, so the set sizes may be similar or skewed
+		size_t offset1 = array1.Offset ();
+		size_t count1 = array1.Count (offset1);
+		size_t offset2 = array2.Offset ();
+		size_t count2 = array2.Count (offset2) >> (i % 12);
+
+		// Do many tries with the same offset and element count, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the arrays with random data
+			array1.Populate ();
+			array2.Populate ();
+			const vector <T> set1 = MakeSet (array1, offset1, count1);
+			const vector <T> set2 = MakeSet (array2, offset2, count2);
+
+			// Check both orders of the operands with all the algorithms
+			for (bool swapped : {false, true}) {
+				const vector <T> &a = swapped ? set2 : set1;
+				const vector <T> &b = swapped ? set1 : set2;
+				vector <T> correct (a.size() + b.size());
+				correct.resize (ref (a.data(), a.data() + a.size(), b.data(), b.data() + b.size(), correct.data()) - correct.data());
+				for (SortedSet::Path path : {SortedSet::AUTO, SortedSet::MERGE, SortedSet::GALLOP}) {
+					const size_t count = func (target.data(), a.data(), a.size(), b.data(), b.size(), path);
+					CheckSet (target.data(), count, correct);
+				}
+			}
+		}
+	}
+}
+
+//****************************************************************************//
+//      Test function for the intersection of many sets                       //
+//****************************************************************************//
+template <typename T>
+void TestSortedSetIntersectionK (void) {
+
+	// Create an array of the target size
+	RandomArray <T> array (BUFFER_SIZE, SEED, SetRange <T> ());
+	vector <T> target (BUFFER_SIZE);
+	mt19937_64 generator (SEED);
+
+	// Run the test in many rounds with a random count of sets
+	for (size_t i = 0; i < ROUNDS; i++) {
+		const size_t count = i % 6;
+
+		// Do many tries with the same count of sets, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Sets of random sizes. The elements of a common set are put into
+			// most sets, so the intersection is not empty
+			array.Populate ();
+			const vector <T> common = MakeSet (array, 0, BUFFER_SIZE / 50);
+			vector <vector <T>> sets (count);
+			vector <const T*> pointers (count);
+			vector <size_t> sizes (count);
+			for (size_t k = 0; k < count; k++) {
+				array.Populate ();
+				size_t offset = array.Offset ();
+				vector <T> set = MakeSet (array, offset, array.Count (offset) >> (generator () % 8));
+				if (k != 3) {
+					vector <T> merged (set.size() + common.size());
+					merged.resize (set_union (set.begin(), set.end(), common.begin(), common.end(), merged.begin()) - merged.begin());
+					set.swap (merged);
+				}
+				sets[k] = set;
+				pointers[k] = sets[k].data();
+				sizes[k] = sets[k].size();
+			}
+
+			// Intersection of all the sets by the standard library
+			vector <T> correct = count ? sets[0] : vector <T> ();
+			for (size_t k = 1; k < count; k++) {
+				vector <T> next (correct.size());
+				next.resize (set_intersection (correct.begin(), correct.end(), sets[k].begin(), sets[k].end(), next.begin()) - next.begin());
+				correct.swap (next);
+			}
+
+			// Apply the operation to the sets
+			const size_t result = SortedSet::Intersection (target.data(), pointers.data(), sizes.data(), count);
+			CheckSet (target.data(), result, correct);
+		}
+	}
+}
+
+//****************************************************************************//
+//      Reference set operations                                              //
+//****************************************************************************//
+template <typename T>
+T* SetIntersection (const T* first1, const T* last1, const T* first2, const T* last2, T* target) {
+	return set_intersection (first1, last1, first2, last2, target);
+}
+template <typename T>
+T* SetUnion (const T* first1, const T* last1, const T* first2, const T* last2, T* target) {
+	return set_union (first1, last1, first2, last2, target);
+}
+template <typename T>
+T* SetDifference (const T* first1, const T* last1, const T* first2, const T* last2, T* target) {
+	return set_difference (first1, last1, first2, last2, target);
+}
+
+//****************************************************************************//
+//      Unit test routines                                                    //
+//****************************************************************************//
+
+//============================================================================//
+//      Operations on two sets                                                //
+//============================================================================//
+# define	SORTED_SET(func,ref)												\
+void TestSortedSet##func (void) {												\
+	StageInfo ("SortedSet::" # func, BUFFER_SIZE, ROUNDS, TRIES);				\
+	TestSortedSet <uint8_t> (SortedSet::func, ref);								\
+	TestSortedSet <uint16_t> (SortedSet::func, ref);							\
+	TestSortedSet <uint32_t> (SortedSet::func, ref);							\
+	TestSortedSet <uint64_t> (SortedSet::func, ref);							\
+	TestSortedSet <sint8_t> (SortedSet::func, ref);								\
+	TestSortedSet <sint16_t> (SortedSet::func, ref);							\
+	TestSortedSet <sint32_t> (SortedSet::func, ref);							\
+	TestSortedSet <sint64_t> (SortedSet::func, ref);							\
+	TestSortedSet <size_t> (SortedSet::func, ref);								\
+}
+
+// Intersection
+SORTED_SET (Intersection, SetIntersection)
+
+// Union
+SORTED_SET (Union, SetUnion)
+
+// Difference
+SORTED_SET (Difference, SetDifference)
+
+//============================================================================//
+//      Intersection of many sets                                             //
+//============================================================================//
+void TestSortedSetIntersectionK (void) {
+
+	// Show the stage info
+	StageInfo ("SortedSet::Intersection (k-way)", BUFFER_SIZE, ROUNDS, TRIES);
+
+	// Unsigned integer types
+	TestSortedSetIntersectionK <uint8_t> ();
+	TestSortedSetIntersectionK <uint16_t> ();
+	TestSortedSetIntersectionK <uint32_t> ();
+	TestSortedSetIntersectionK <uint64_t> ();
+
+	// Signed integer types
+	TestSortedSetIntersectionK <sint8_t> ();
+	TestSortedSetIntersectionK <sint16_t> ();
+	TestSortedSetIntersectionK <sint32_t> ();
+	TestSortedSetIntersectionK <sint64_t> ();
+
+	// Other types
+	TestSortedSetIntersectionK <size_t> ();
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
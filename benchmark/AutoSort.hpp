@@ -0,0 +1,85 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#          BENCHMARKS FOR THE AUTOMATIC CHOICE OF THE SORT ALGORITHM           #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<random>
+# include	"../ext/AutoSort.hpp"
+
+//****************************************************************************//
+//      Names of the sort kernels and input classes                           //
+//****************************************************************************//
+const char* KernelName (AutoSort::Kernel kernel) {
+	static const char* names[] = {"none", "quick", "merge", "radix"};
+	return names[kernel];
+}
+const char* InputName (size_t input) {
+	static const char* names[] = {"random", "presorted", "duplicates"};
+	return names[input];
+}
+
+//****************************************************************************//
+//      Calibrate and benchmark the sorter for the key type                   //
+//****************************************************************************//
+template <typename T>
+void BenchAutoSort (
+	const string &type,			// Name of the key type
+	size_t size					// Count of keys
+){
+	// Crossover table measured on this machine
+	cout << "      type = " << type << endl;
+	const AutoSort sorter (AutoSort::Calibrate <T> ());
+	for (size_t input = 0; input < AutoSort::INPUTS; input++) {
+		cout << "        " << left << setw (12) << InputName (input) << right;
+		for (size_t bucket = 0; bucket < AutoSort::BUCKETS; bucket++)
+			cout << setw (10) << AutoSort::BUCKET_SIZE[bucket] << ": " << KernelName (sorter.Crossovers().kernel[input][bucket]);
+		cout << endl;
+	}
+
+	// Each kernel and the automatic choice on the arrays of each input class
+	vector <T> source (size), array (size), temp (size);
+	mt19937_64 generator (BENCH_SEED);
+	auto setup = [&]{ Array::Copy (array.data(), source.data(), size); };
+	for (size_t input = 0; input < AutoSort::INPUTS; input++) {
+		AutoSort::Generate (source.data(), size, static_cast <AutoSort::Input> (input), generator);
+		cout << "      input = " << InputName (input) << endl;
+		for (AutoSort::Kernel kernel : {AutoSort::QUICK, AutoSort::MERGE, AutoSort::RADIX}) {
+			const AutoSort forced (AutoSort::Table {{
+				{kernel, kernel, kernel, kernel},
+				{kernel, kernel, kernel, kernel},
+				{kernel, kernel, kernel, kernel}
+			}});
+			AutoSort::Kernel used = AutoSort::NONE;
+			double time = BestTime (setup, [&]{ used = forced.SortAsc (array.data(), temp.data(), size); });
+			if (used == kernel)
+				BenchResult (string (KernelName (kernel)) + " sort", time, size, "keys");
+		}
+		AutoSort::Kernel used = AutoSort::NONE;
+		double time = BestTime (setup, [&]{ used = sorter.SortAsc (array.data(), temp.data(), size); });
+		BenchResult (string ("AutoSort::SortAsc (") + KernelName (used) + ")", time, size, "keys");
+	}
+}
+
+//****************************************************************************//
+//      Benchmark routine                                                     //
+//****************************************************************************//
+void BenchAutoSort (void) {
+
+	// Show the stage info
+	BenchInfo ("AutoSort", BENCH_SIZE, BENCH_ROUNDS);
+
+	// Different key types
+	BenchAutoSort <uint32_t> ("uint32_t", BENCH_SIZE);
+	BenchAutoSort <uint64_t> ("uint64_t", BENCH_SIZE);
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,80 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#             BENCHMARKS FOR THE BATCHED COUNTING IN SORTED ARRAYS             #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<random>
+# include	<algorithm>
+# include	"../ext/BatchCount.hpp"
+
+//****************************************************************************//
+//      Benchmark counting of the queries in a sorted array of the size       //
+//****************************************************************************//
+void BenchBatchCount (
+	size_t size,				// Count of elements in the array
+	size_t range,				// Count of distinct values
+	size_t queries				// Count of values to count
+){
+	// Sorted column of the dictionary values and random values to count
+	vector <uint32_t> array (size), values (queries);
+	vector <size_t> count (queries);
+	mt19937_64 generator (BENCH_SEED);
+	uniform_int_distribution <uint32_t> distribution (0, range - 1);
+	for (uint32_t &value : array)
+		value = distribution (generator);
+	for (uint32_t &value : values)
+		value = distribution (generator);
+	sort (array.begin(), array.end());
+	cout << "      size = " << size << ", distinct = " << range << ", queries = " << queries << endl;
+
+	// Binary counting of each value
+	double time = BestTime ([&]{
+		for (size_t i = 0; i < queries; i++)
+			count[i] = Array::CountAsc (array.data(), size, values[i]);
+		Consume (count[0]);
+	});
+	BenchResult ("Array::CountAsc", time, queries, "queries");
+
+	// Two lower bounds for each value
+	time = BestTime ([&]{
+		for (size_t i = 0; i < queries; i++) {
+			auto first = lower_bound (array.begin(), array.end(), values[i]);
+			auto last = lower_bound (first, array.end(), values[i] + 1);
+			count[i] = last - first;
+		}
+		Consume (count[0]);
+	});
+	BenchResult ("std::lower_bound x 2", time, queries, "queries");
+
+	// Batched counting
+	time = BestTime ([&]{
+		BatchCount::CountAsc (count.data(), array.data(), size, values.data(), queries);
+		Consume (count[0]);
+	});
+	BenchResult ("BatchCount::CountAsc", time, queries, "queries");
+}
+
+//****************************************************************************//
+//      Benchmark routine                                                     //
+//****************************************************************************//
+void BenchBatchCount (void) {
+
+	// Show the stage info
+	BenchInfo ("BatchCount", BENCH_SIZE, BENCH_ROUNDS);
+
+	// Dictionaries of different sizes, from few queries to a million
+	for (size_t range : {1000, 1000000})
+		for (size_t queries = BENCH_SIZE / 1000; queries <= BENCH_SIZE / 10; queries *= 10)
+			BenchBatchCount (BENCH_SIZE, range, queries);
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,69 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#              BENCHMARKS FOR THE BATCH INSERT INTO SORTED ARRAYS              #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<random>
+# include	<algorithm>
+# include	"../ext/BatchInsert.hpp"
+
+//****************************************************************************//
+//      Benchmark the batch insert against the full re-sort                   //
+//****************************************************************************//
+void BenchBatchInsert (
+	size_t size					// Count of elements in the sorted array
+){
+	// Sorted array of random 64-bit values and a pool of random batch values
+	vector <uint64_t> source (size), batches (size);
+	mt19937_64 generator (BENCH_SEED);
+	for (size_t i = 0; i < size; i++) {
+		source[i] = generator ();
+		batches[i] = generator ();
+	}
+	sort (source.begin(), source.end());
+	vector <uint64_t> array (2 * size), batch (size), temp (2 * size);
+	cout << "      size = " << size << endl;
+
+	// Batch sizes up to the array size
+	for (size_t count = 1; count <= size; count *= 10) {
+		auto setup = [&]{
+			Array::Copy (array.data(), source.data(), size);
+			Array::Copy (batch.data(), batches.data(), count);
+		};
+
+		// Append the batch and sort the whole array again
+		double time = BestTime (setup, [&]{
+			Array::Copy (array.data() + size, batch.data(), count);
+			Array::RadixSortAsc (array.data(), temp.data(), size + count);
+		});
+		BenchResult ("Array::RadixSortAsc, batch = " + to_string (count), time, size + count, "elements");
+
+		// Merge the batch into the array
+		time = BestTime (setup, [&]{ Consume (BatchInsert::InsertAsc (array.data(), size, batch.data(), count)); });
+		BenchResult ("BatchInsert::InsertAsc, batch = " + to_string (count), time, size + count, "elements");
+	}
+}
+
+//****************************************************************************//
+//      Benchmark routine                                                     //
+//****************************************************************************//
+void BenchBatchInsert (void) {
+
+	// Show the stage info
+	BenchInfo ("BatchInsert", BENCH_SIZE, BENCH_ROUNDS);
+
+	// Array sizes from the cache to the memory
+	for (size_t size = BENCH_SIZE / 100; size <= BENCH_SIZE; size *= 10)
+		BenchBatchInsert (size);
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,77 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                 BENCHMARKS FOR THE BIT-PACKED INTEGER ARRAYS                 #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<random>
+# include	"../ext/BitPacking.hpp"
+
+# define	PACK_BLOCK		4096	// Values unpacked at once by a scan
+
+//****************************************************************************//
+//      Benchmark the packed column of the target width                       //
+//****************************************************************************//
+void BenchBitPacking (
+	const vector <uint32_t> &column,	// Unpacked column
+	size_t bits							// Width of the values in bits
+){
+	const size_t size = column.size();
+	vector <uint32_t> values (size), result (size);
+	const uint32_t mask = bits < 32 ? (1U << bits) - 1 : ~0U;
+	for (size_t i = 0; i < size; i++)
+		values[i] = column[i] & mask;
+	vector <uint64_t> words (BitPacking::Words (size, bits));
+	BitPacking::Pack (words.data(), values.data(), size, bits);
+	cout << "      width = " << bits << " bits, packed " << words.size() * sizeof (uint64_t) << " bytes" << endl;
+
+	// Decoding of the whole column
+	double time = BestTime ([&]{ BitPacking::Unpack (result.data(), words.data(), size, bits); });
+	BenchResult ("BitPacking::Unpack", time, size * sizeof (uint32_t), "B");
+
+	// Scan of the unpacked column
+	time = BestTime ([&]{ Consume (Array::Max (values.data(), size)); });
+	BenchResult ("Array::Max (unpacked)", time, size, "values");
+
+	// Scan of the packed column, decoded block by block into the cache
+	time = BestTime ([&]{
+		uint32_t block [PACK_BLOCK];
+		uint32_t max = 0;
+		for (size_t i = 0; i < size; i += PACK_BLOCK) {
+			const size_t count = min <size_t> (PACK_BLOCK, size - i);
+			BitPacking::Unpack (block, words.data() + i * bits / 64, count, bits);
+			max = std::max (max, Array::Max (block, count));
+		}
+		Consume (max);
+	});
+	BenchResult ("Array::Max (packed)", time, size, "values");
+}
+
+//****************************************************************************//
+//      Benchmark routine                                                     //
+//****************************************************************************//
+void BenchBitPacking (void) {
+
+	// Show the stage info
+	BenchInfo ("BitPacking", BENCH_SIZE * 4, BENCH_ROUNDS);
+
+	// Random column of 32-bit integers
+	vector <uint32_t> column (BENCH_SIZE * 4);
+	mt19937 generator (BENCH_SEED);
+	for (uint32_t &value : column)
+		value = generator ();
+
+	// Different widths of the values
+	for (size_t bits : {1, 4, 7, 8, 12, 16, 24, 32})
+		BenchBitPacking (column, bits);
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
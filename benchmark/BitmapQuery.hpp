@@ -0,0 +1,77 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                    BENCHMARKS FOR THE BITMAP QUERY ENGINE                    #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	"Patterns.hpp"
+# include	"../ext/BitmapQuery.hpp"
+
+//****************************************************************************//
+//      Benchmark the block-wise evaluation against whole-bitmap passes       //
+//****************************************************************************//
+
+// The reference evaluates the same query with a single Array:: pass over the
+// whole bitmaps per operator, streaming a full-size temporary through memory.
+void BenchBitmapQuery (
+	double density				// Fraction of set bits in the first predicate
+){
+	const size_t bits = BENCH_SIZE * 8;
+	const size_t words = bits / 64;
+	vector <uint64_t> a (words), b (words), c (words), d (words);
+	vector <uint64_t> result (words), temp (words);
+	RandomBits (a, density, 0);
+	RandomBits (b, 0.5, 0);
+	RandomBits (c, 0.5, 1000);
+	RandomBits (d, 0.3, 0);
+	cout << "      selectivity of a = " << density << endl;
+
+	// Query: a AND (b OR c) AND NOT d
+	BitmapQuery query;
+	size_t bc = query.Or (query.Leaf (b.data()), query.Leaf (c.data()));
+	size_t root = query.And (query.And (query.Leaf (a.data()), bc), query.Not (query.Leaf (d.data())));
+
+	// Whole-bitmap passes per operator
+	double time = BestTime ([&]{
+		Array::Copy (result.data(), b.data(), words);
+		Array::OrVector (result.data(), c.data(), words);
+		Array::AndVector (result.data(), a.data(), words);
+		Array::Copy (temp.data(), d.data(), words);
+		Array::Not (temp.data(), words);
+		Array::AndVector (result.data(), temp.data(), words);
+		Consume (BitField::CountBits (result.data(), 0, bits));
+	});
+	BenchResult ("Array:: passes (evaluate)", time, bits, "bits");
+
+	// Block-wise evaluation
+	time = BestTime ([&]{ Consume (query.Evaluate (root, result.data(), bits)); });
+	BenchResult ("BitmapQuery::Evaluate", time, bits, "bits");
+	time = BestTime ([&]{ Consume (query.Count (root, bits)); });
+	BenchResult ("BitmapQuery::Count", time, bits, "bits");
+	time = BestTime ([&]{ Consume (query.FindFirst (root, bits)); });
+	BenchResult ("BitmapQuery::FindFirst", time, bits, "bits");
+}
+
+//****************************************************************************//
+//      Benchmark routine                                                     //
+//****************************************************************************//
+void BenchBitmapQuery (void) {
+
+	// Show the stage info
+	BenchInfo ("BitmapQuery", BENCH_SIZE * 8, BENCH_ROUNDS);
+
+	// Dense and selective first predicate
+	BenchBitmapQuery (0.5);
+	BenchBitmapQuery (0.001);
+	BenchBitmapQuery (0.0);
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,76 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                       BENCHMARKS FOR THE BLOOM FILTER                        #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<memory>
+# include	"Patterns.hpp"
+# include	"../ext/BloomFilter.hpp"
+
+//****************************************************************************//
+//      Benchmark the Bloom filter configuration                              //
+//****************************************************************************//
+void BenchBloomFilter (
+	const vector <uint64_t> &keys,		// Inserted keys
+	const vector <uint64_t> &queries,	// Query keys (half of them are inserted)
+	size_t bits_per_key,				// Filter bits per inserted key
+	size_t hashes,						// Count of bits per key
+	bool blocked,						// Cache line local bits
+	bool prefetch						// Prefetch the lines of batched keys
+){
+	BloomFilter filter (keys.size() * bits_per_key, hashes, blocked, prefetch);
+	unique_ptr <bool[]> flags (new bool [queries.size()]);
+
+	// Insertion
+	double time = BestTime ([&]{ filter.Insert (keys.data(), keys.size()); });
+	string name = string (blocked ? "blocked" : "classic") + (prefetch ? " + prefetch" : "");
+	BenchResult ("Insert (" + name + ")", time, keys.size(), "keys");
+
+	// Queries
+	size_t found = 0;
+	time = BestTime ([&]{ found = filter.Query (flags.get(), queries.data(), queries.size()); });
+	BenchResult ("Query (" + name + ")", time, queries.size(), "keys");
+
+	// False positive rate of the keys which are not in the set
+	const double measured = (found - queries.size() / 2) / (queries.size() / 2.0);
+	cout << "        false positives: measured " << measured << ", theory ";
+	cout << filter.FalsePositiveRate (keys.size()) << endl;
+}
+
+//****************************************************************************//
+//      Benchmark routine                                                     //
+//****************************************************************************//
+void BenchBloomFilter (void) {
+
+	// Show the stage info
+	BenchInfo ("BloomFilter", BENCH_SIZE, BENCH_ROUNDS);
+
+	// Even keys are inserted, odd keys are not in the set
+	vector <uint64_t> keys (BENCH_SIZE), queries (BENCH_SIZE);
+	mt19937_64 generator (BENCH_SEED);
+	for (size_t i = 0; i < BENCH_SIZE; i++) {
+		keys[i] = generator () & ~static_cast <uint64_t> (1);
+		queries[i] = i % 2 ? keys[i] | 1 : keys[i];
+	}
+
+	// Classic and blocked filters with and without prefetching
+	for (size_t bits_per_key : {8, 16}) {
+		const size_t hashes = bits_per_key * 7 / 10;
+		cout << "      bits per key = " << bits_per_key << ", hashes = " << hashes << endl;
+		BenchBloomFilter (keys, queries, bits_per_key, hashes, false, false);
+		BenchBloomFilter (keys, queries, bits_per_key, hashes, false, true);
+		BenchBloomFilter (keys, queries, bits_per_key, hashes, true, false);
+		BenchBloomFilter (keys, queries, bits_per_key, hashes, true, true);
+	}
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,45 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#           BENCHMARKS FOR THE SORT WITH A BOUNDED TEMPORARY BUFFER            #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<random>
+# include	"../ext/BoundedSort.hpp"
+
+//****************************************************************************//
+//      Benchmark routine                                                     //
+//****************************************************************************//
+void BenchBoundedSort (void) {
+
+	// Show the stage info
+	BenchInfo ("BoundedSort", BENCH_SIZE, BENCH_ROUNDS);
+
+	// Random 64-bit keys
+	vector <uint64_t> source (BENCH_SIZE), array (BENCH_SIZE), temp (BENCH_SIZE);
+	mt19937_64 generator (BENCH_SEED);
+	for (uint64_t &value : source)
+		value = generator ();
+	auto setup = [&]{ Array::Copy (array.data(), source.data(), BENCH_SIZE); };
+
+	// Radix sort with the full size temporary array
+	double time = BestTime (setup, [&]{ Array::RadixSortAsc (array.data(), temp.data(), BENCH_SIZE); });
+	BenchResult ("Array::RadixSortAsc (budget 100%)", time, BENCH_SIZE, "keys");
+
+	// Temporary arrays of different size in percent of the array
+	for (size_t budget : {1, 2, 5, 10, 25, 50, 100}) {
+		const size_t tsize = BENCH_SIZE * budget / 100;
+		time = BestTime (setup, [&]{ BoundedSort::SortAsc (array.data(), temp.data(), tsize, BENCH_SIZE); });
+		BenchResult ("BoundedSort::SortAsc (budget " + to_string (budget) + "%)", time, BENCH_SIZE, "keys");
+	}
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,68 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                    BENCHMARKS FOR THE DICTIONARY ENCODING                    #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<random>
+# include	"../ext/Dictionary.hpp"
+
+//****************************************************************************//
+//      Benchmark the encoding of a column of the cardinality                 //
+//****************************************************************************//
+template <typename T>
+void BenchDictionary (
+	const string &type,			// Name of the value type
+	size_t range				// Count of distinct values
+){
+	// Column of random values of the cardinality
+	vector <T> array (BENCH_SIZE), dictionary (BENCH_SIZE), decoded (BENCH_SIZE);
+	vector <uint32_t> code (BENCH_SIZE);
+	mt19937_64 generator (BENCH_SEED);
+	uniform_int_distribution <uint64_t> distribution (0, range - 1);
+	for (T &value : array)
+		value = static_cast <T> (distribution (generator) * 1000003);
+	const double bytes = BENCH_SIZE * sizeof (T);
+	cout << "      distinct = " << range << ", type = " << type << endl;
+
+	// Sorted encoding
+	double time = BestTime ([&]{ Consume (Dictionary::EncodeSorted (dictionary.data(), code.data(), array.data(), BENCH_SIZE)); });
+	BenchResult ("Dictionary::EncodeSorted", time, bytes, "B");
+
+	// Hash encoding
+	time = BestTime ([&]{ Consume (Dictionary::EncodeHash (dictionary.data(), code.data(), array.data(), BENCH_SIZE)); });
+	BenchResult ("Dictionary::EncodeHash", time, bytes, "B");
+
+	// Decoding
+	time = BestTime ([&]{
+		Dictionary::Decode (decoded.data(), code.data(), BENCH_SIZE, dictionary.data());
+		Consume (decoded[0]);
+	});
+	BenchResult ("Dictionary::Decode", time, bytes, "B");
+}
+
+//****************************************************************************//
+//      Benchmark routine                                                     //
+//****************************************************************************//
+void BenchDictionary (void) {
+
+	// Show the stage info
+	BenchInfo ("Dictionary", BENCH_SIZE, BENCH_ROUNDS);
+
+	// Low-cardinality columns of different types
+	for (size_t range : {16, 1000, 100000}) {
+		BenchDictionary <uint32_t> ("uint32_t", range);
+		BenchDictionary <uint64_t> ("uint64_t", range);
+		BenchDictionary <flt64_t> ("flt64_t", range);
+	}
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,66 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                       BENCHMARKS FOR THE EXTERNAL SORT                       #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<random>
+# include	<fstream>
+# include	<filesystem>
+# include	"../ext/ExternalSort.hpp"
+
+//****************************************************************************//
+//      Benchmark routine                                                     //
+//****************************************************************************//
+void BenchExternalSort (void) {
+
+	// Show the stage info
+	BenchInfo ("ExternalSort", BENCH_SIZE, BENCH_ROUNDS);
+
+	// File of random 64-bit keys on the local disk
+	const string input = (filesystem::temp_directory_path () / "ExternalSortBench.in").string();
+	const string output = (filesystem::temp_directory_path () / "ExternalSortBench.out").string();
+	vector <uint64_t> array (BENCH_SIZE), temp (BENCH_SIZE);
+	mt19937_64 generator (BENCH_SEED);
+	for (uint64_t &value : array)
+		value = generator ();
+	const size_t bytes = BENCH_SIZE * sizeof (uint64_t);
+	{
+		ofstream file (input, ios::binary | ios::trunc);
+		file.write (reinterpret_cast <const char*> (array.data()), bytes);
+	}
+
+	// In-memory sort of the same keys as the upper bound
+	vector <uint64_t> source (array);
+	double time = BestTime ([&]{ Array::Copy (array.data(), source.data(), BENCH_SIZE); }, [&]{
+		Array::RadixSortAsc (array.data(), temp.data(), BENCH_SIZE);
+	});
+	BenchResult ("Array::RadixSortAsc (in memory)", time, bytes, "B");
+
+	// Different run and merge buffer sizes, through the page cache and
+	// with the direct I/O
+	for (bool direct : {false, true}) {
+		cout << "      direct I/O = " << (direct ? "yes" : "no") << endl;
+		for (size_t run : {1 << 20, 8 << 20, 64 << 20}) {
+			for (size_t buffer : {64 << 10, 1 << 20}) {
+				size_t runs = 0;
+				time = BestTime ([&]{ runs = ExternalSort::SortAsc <uint64_t> (input, output, run, buffer, direct); });
+				BenchResult ("run " + to_string (run >> 10) + " KB, buffer " + to_string (buffer >> 10) + " KB, " + to_string (runs) + " runs", time, bytes, "B");
+			}
+		}
+	}
+
+	// Remove the temporary files
+	filesystem::remove (input);
+	filesystem::remove (output);
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
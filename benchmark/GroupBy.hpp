@@ -0,0 +1,59 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                   BENCHMARKS FOR THE GROUP-BY AGGREGATION                    #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<random>
+# include	"../ext/GroupBy.hpp"
+
+//****************************************************************************//
+//      Benchmark the aggregation of a key column of the cardinality          //
+//****************************************************************************//
+void BenchGroupBy (
+	size_t range				// Count of distinct keys
+){
+	// Random keys of the cardinality and random values
+	vector <uint32_t> key (BENCH_SIZE), group (BENCH_SIZE);
+	vector <flt64_t> value (BENCH_SIZE), sum (BENCH_SIZE), min (BENCH_SIZE), max (BENCH_SIZE);
+	vector <size_t> count (BENCH_SIZE);
+	mt19937_64 generator (BENCH_SEED);
+	uniform_int_distribution <uint32_t> distribution (0, range - 1);
+	uniform_real_distribution <flt64_t> values (0.0, 1.0);
+	for (size_t i = 0; i < BENCH_SIZE; i++) {
+		key[i] = distribution (generator) * 0x9E3779B9U;
+		value[i] = values (generator);
+	}
+	cout << "      groups = " << range << endl;
+
+	// Both algorithms and the automatic choice
+	for (auto [method, name] : {pair (GroupBy::SORT, "SORT"), pair (GroupBy::HASH, "HASH"), pair (GroupBy::AUTO, "AUTO")}) {
+		const double time = BestTime ([&]{
+			Consume (GroupBy::Aggregate (group.data(), count.data(), sum.data(), min.data(), max.data(), key.data(), value.data(), BENCH_SIZE, method));
+		});
+		BenchResult ("GroupBy::Aggregate (" + string (name) + ")", time, BENCH_SIZE, "rows");
+	}
+}
+
+//****************************************************************************//
+//      Benchmark routine                                                     //
+//****************************************************************************//
+void BenchGroupBy (void) {
+
+	// Show the stage info
+	BenchInfo ("GroupBy", BENCH_SIZE, BENCH_ROUNDS);
+
+	// Cardinalities from few groups to all distinct keys
+	for (size_t range = 10; range <= BENCH_SIZE; range *= 10)
+		BenchGroupBy (range);
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,63 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                BENCHMARKS FOR THE HASH-BASED DISTINCT VALUES                 #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<random>
+# include	"../ext/HashDistinct.hpp"
+
+//****************************************************************************//
+//      Benchmark the duplicate counting of an array of the cardinality       //
+//****************************************************************************//
+template <typename T>
+void BenchHashDistinct (
+	size_t range				// Count of distinct values
+){
+	// Random values of the cardinality
+	vector <T> source (BENCH_SIZE), array (BENCH_SIZE), temp (BENCH_SIZE), unique (BENCH_SIZE);
+	vector <size_t> count (BENCH_SIZE);
+	mt19937_64 generator (BENCH_SEED);
+	uniform_int_distribution <uint64_t> distribution (0, range - 1);
+	for (T &value : source)
+		value = static_cast <T> (distribution (generator) * 0x9E3779B97F4A7C15ULL);
+	auto setup = [&]{ Array::Copy (array.data(), source.data(), BENCH_SIZE); };
+	cout << "      distinct = " << range << ", bits = " << 8 * sizeof (T) << endl;
+
+	// Sort the array and count the runs of equal values
+	double time = BestTime (setup, [&]{
+		Array::RadixSortAsc (array.data(), temp.data(), BENCH_SIZE);
+		Consume (Array::Duplicates (unique.data(), count.data(), array.data(), BENCH_SIZE));
+	});
+	BenchResult ("Array::RadixSortAsc + Duplicates", time, BENCH_SIZE, "elements");
+
+	// Count the values in the hash tables
+	time = BestTime ([&]{
+		Consume (HashDistinct::Duplicates (unique.data(), count.data(), source.data(), BENCH_SIZE));
+	});
+	BenchResult ("HashDistinct::Duplicates", time, BENCH_SIZE, "elements");
+}
+
+//****************************************************************************//
+//      Benchmark routine                                                     //
+//****************************************************************************//
+void BenchHashDistinct (void) {
+
+	// Show the stage info
+	BenchInfo ("HashDistinct", BENCH_SIZE, BENCH_ROUNDS);
+
+	// Cardinalities from few values to all distinct values
+	for (size_t range = 10; range <= BENCH_SIZE; range *= 10)
+		BenchHashDistinct <uint64_t> (range);
+	BenchHashDistinct <uint32_t> (BENCH_SIZE / 100);
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,83 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                       BENCHMARKS FOR THE LEARNED INDEX                       #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<random>
+# include	<algorithm>
+# include	"../ext/LearnedIndex.hpp"
+# include	"../ext/SearchTree.hpp"
+
+# define	LEARNED_QUERIES	1000000		// Count of random queries
+
+//****************************************************************************//
+//      Benchmark the searches in a sorted array of the size                  //
+//****************************************************************************//
+void BenchLearnedIndex (
+	size_t size					// Count of keys
+){
+	// Sorted near-uniform keys and random queries over the same range
+	vector <uint64_t> array (size), query (LEARNED_QUERIES);
+	mt19937_64 generator (BENCH_SEED);
+	for (uint64_t &value : array)
+		value = generator ();
+	for (uint64_t &value : query)
+		value = generator ();
+	sort (array.begin(), array.end());
+	cout << "      size = " << size << " (" << size * sizeof (uint64_t) / 1024 << " KB)" << endl;
+
+	// Binary search of the array
+	double time = BestTime ([&]{
+		size_t sum = 0;
+		for (uint64_t value : query)
+			sum += Array::FindGreatOrEqualAsc (array.data(), size, value);
+		Consume (sum);
+	});
+	BenchResult ("Array::FindGreatOrEqualAsc", time, LEARNED_QUERIES, "queries");
+
+	// Static B+ tree
+	const STree <uint64_t> stree (array.data(), size);
+	time = BestTime ([&]{
+		size_t sum = 0;
+		for (uint64_t value : query)
+			sum += stree.FindGreatOrEqual (value);
+		Consume (sum);
+	});
+	BenchResult ("STree (" + to_string (stree.Memory() / 1024) + " KB)", time, LEARNED_QUERIES, "queries");
+
+	// Learned indices of different max errors
+	for (size_t error : {8, 32, 128}) {
+		const LearnedIndex <uint64_t> index (array.data(), size, error);
+		time = BestTime ([&]{
+			size_t sum = 0;
+			for (uint64_t value : query)
+				sum += index.FindGreatOrEqual (value);
+			Consume (sum);
+		});
+		BenchResult ("LearnedIndex (error = " + to_string (error) + ", " + to_string (index.Memory() / 1024) + " KB)", time, LEARNED_QUERIES, "queries");
+	}
+}
+
+//****************************************************************************//
+//      Benchmark routine                                                     //
+//****************************************************************************//
+void BenchLearnedIndex (void) {
+
+	// Show the stage info
+	BenchInfo ("LearnedIndex", BENCH_SIZE, BENCH_ROUNDS);
+
+	// Sizes from the cache to far past the last level cache
+	for (size_t size = BENCH_SIZE / 10; size <= BENCH_SIZE; size *= 10)
+		BenchLearnedIndex (size);
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,61 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#              BENCHMARKS FOR THE MULTI-COLUMN LEXICOGRAPHIC SORT              #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<random>
+# include	<tuple>
+# include	<algorithm>
+# include	"../ext/MultiColumnSort.hpp"
+
+//****************************************************************************//
+//      Benchmark routine                                                     //
+//****************************************************************************//
+void BenchMultiColumnSort (void) {
+
+	// Show the stage info
+	BenchInfo ("MultiColumnSort", BENCH_SIZE, BENCH_ROUNDS);
+
+	// Table of three columns: few distinct 32-bit values, then random doubles
+	// in descending order, then random 64-bit values
+	vector <uint32_t> col1 (BENCH_SIZE);
+	vector <flt64_t> col2 (BENCH_SIZE);
+	vector <uint64_t> col3 (BENCH_SIZE);
+	mt19937_64 generator (BENCH_SEED);
+	for (size_t i = 0; i < BENCH_SIZE; i++) {
+		col1[i] = generator () % 100;
+		col2[i] = static_cast <flt64_t> (generator () % 1000) / 10.0;
+		col3[i] = generator ();
+	}
+	vector <size_t> rows (BENCH_SIZE);
+
+	// Sort of the row indices with a tuple comparator
+	double time = BestTime ([&]{
+		for (size_t i = 0; i < BENCH_SIZE; i++)
+			rows[i] = i;
+	}, [&]{
+		sort (rows.begin(), rows.end(), [&](size_t x, size_t y){
+			return make_tuple (col1[x], -col2[x], col3[x]) < make_tuple (col1[y], -col2[y], col3[y]);
+		});
+	});
+	BenchResult ("std::sort (tuple comparator)", time, BENCH_SIZE, "rows");
+
+	// LSD passes of the key sorts
+	MultiColumnSort sorter;
+	sorter.Column (col1.data(), MultiColumnSort::ASC).Column (col2.data(), MultiColumnSort::DSC).Column (col3.data(), MultiColumnSort::ASC);
+	time = BestTime ([&]{ sorter.Sort (rows.data(), BENCH_SIZE, MultiColumnSort::RADIX); });
+	BenchResult ("MultiColumnSort::Sort (radix)", time, BENCH_SIZE, "rows");
+	time = BestTime ([&]{ sorter.Sort (rows.data(), BENCH_SIZE, MultiColumnSort::MERGE); });
+	BenchResult ("MultiColumnSort::Sort (merge)", time, BENCH_SIZE, "rows");
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,123 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#               BENCHMARKS FOR THE OBJECT SORT BY EXTRACTED KEYS               #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<random>
+# include	<algorithm>
+# include	"../ext/ObjectSort.hpp"
+
+//****************************************************************************//
+//      Object arrays made of keys                                            //
+//****************************************************************************//
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Key compare function                                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+sint64_t BenchKeyCmp (const void *key1, const void *key2) {
+	const sint64_t val1 = reinterpret_cast <const size_t> (key1);
+	const sint64_t val2 = reinterpret_cast <const size_t> (key2);
+	return (val1 > val2) - (val1 < val2);
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Key of an object                                                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+sint64_t BenchKeyOf (const void *key) {
+	return reinterpret_cast <const size_t> (key);
+}
+
+//****************************************************************************//
+//      Records reached through object pointers                               //
+//****************************************************************************//
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Record                                                                //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+struct BenchRecord
+{
+	uint32_t	major;			// Most significant field of the record
+	flt64_t		minor;			// Least significant field of the record
+	char		payload [48];	// Rest of the record
+};
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Compare function for records                                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+sint64_t BenchRecordCmp (const void *record1, const void *record2) {
+	const BenchRecord *rec1 = reinterpret_cast <const BenchRecord*> (record1);
+	const BenchRecord *rec2 = reinterpret_cast <const BenchRecord*> (record2);
+	if (rec1->major != rec2->major)
+		return (rec1->major > rec2->major) - (rec1->major < rec2->major);
+	return (rec1->minor > rec2->minor) - (rec1->minor < rec2->minor);
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Key of a record                                                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+uint32_t BenchRecordKey (const void *record) {
+	return reinterpret_cast <const BenchRecord*> (record)->major;
+}
+
+//****************************************************************************//
+//      Benchmark routine                                                     //
+//****************************************************************************//
+void BenchObjectSort (void) {
+
+	// Show the stage info
+	BenchInfo ("ObjectSort", BENCH_SIZE, BENCH_ROUNDS);
+
+	// Object array made of random keys
+	mt19937_64 generator (BENCH_SEED);
+	vector <const void*> keys (BENCH_SIZE), array (BENCH_SIZE), temp (BENCH_SIZE);
+	for (size_t i = 0; i < BENCH_SIZE; i++)
+		keys[i] = reinterpret_cast <const void*> (generator ());
+
+	// Compare callback versus extracted keys
+	double time = BestTime ([&]{
+		copy (keys.begin(), keys.end(), array.begin());
+	}, [&]{
+		Array::QuickSortObjAsc (array.data(), BENCH_SIZE, BenchKeyCmp);
+	});
+	BenchResult ("Array::QuickSortObjAsc (keys)", time, BENCH_SIZE, "objects");
+	time = BestTime ([&]{
+		copy (keys.begin(), keys.end(), array.begin());
+	}, [&]{
+		ObjectSort::SortAsc (array.data(), temp.data(), BENCH_SIZE, BenchKeyOf);
+	});
+	BenchResult ("ObjectSort::SortAsc (keys)", time, BENCH_SIZE, "objects");
+
+	// Records in random memory order with many distinct major fields
+	vector <BenchRecord> records (BENCH_SIZE);
+	for (size_t i = 0; i < BENCH_SIZE; i++) {
+		records[i].major = generator () % (BENCH_SIZE / 4);
+		records[i].minor = static_cast <flt64_t> (generator () % 1000) / 10.0;
+		keys[i] = &records[i];
+	}
+	shuffle (keys.begin(), keys.end(), generator);
+
+	// Compare callback versus extracted keys with tie breaking
+	time = BestTime ([&]{
+		copy (keys.begin(), keys.end(), array.begin());
+	}, [&]{
+		Array::QuickSortObjAsc (array.data(), BENCH_SIZE, BenchRecordCmp);
+	});
+	BenchResult ("Array::QuickSortObjAsc (records)", time, BENCH_SIZE, "objects");
+	time = BestTime ([&]{
+		copy (keys.begin(), keys.end(), array.begin());
+	}, [&]{
+		ObjectSort::SortAsc (array.data(), temp.data(), BENCH_SIZE, BenchRecordKey, BenchRecordCmp);
+	});
+	BenchResult ("ObjectSort::SortAsc (records)", time, BENCH_SIZE, "objects");
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
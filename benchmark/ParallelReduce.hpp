@@ -0,0 +1,74 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                    BENCHMARKS FOR THE PARALLEL REDUCTIONS                    #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<random>
+# include	"../ext/ParallelReduce.hpp"
+
+//****************************************************************************//
+//      Benchmark routine                                                     //
+//****************************************************************************//
+void BenchParallelReduce (void) {
+
+	// Show the stage info
+	const size_t size = BENCH_SIZE * 2;
+	BenchInfo ("ParallelReduce", size, BENCH_ROUNDS);
+
+	// Random arrays of double values
+	vector <flt64_t> array1 (size), array2 (size), target (size);
+	mt19937_64 generator (BENCH_SEED);
+	uniform_real_distribution <flt64_t> uniform (-1.0, 1.0);
+	for (size_t i = 0; i < size; i++) {
+		array1[i] = uniform (generator);
+		array2[i] = uniform (generator);
+	}
+	const size_t bytes = size * sizeof (flt64_t);
+
+	// Single-threaded kernels
+	cout << "      Array:: kernels" << endl;
+	double time = BestTime ([&]{ Consume (Array::Sum (array1.data(), size)); });
+	BenchResult ("Array::Sum", time, bytes, "B");
+	time = BestTime ([&]{ Consume (Array::SumMul (array1.data(), array2.data(), size)); });
+	BenchResult ("Array::SumMul", time, 2 * bytes, "B");
+	time = BestTime ([&]{ flt64_t min, max; Array::MinMax (array1.data(), size, min, max); Consume (min + max); });
+	BenchResult ("Array::MinMax", time, bytes, "B");
+
+	// Scaling with the thread count. Throughput should grow linearly until it
+	// hits the memory bandwidth, which is about the throughput of the copy
+	for (size_t threads : ThreadCounts ()) {
+		ThreadPool pool (threads);
+		cout << "      threads = " << threads << endl;
+		time = BestTime ([&]{
+			pool.Run (pool.Size(), [&](size_t i){
+				const size_t chunk = size / pool.Size();
+				const size_t count = i + 1 < pool.Size() ? chunk : size - chunk * i;
+				Array::Copy (target.data() + chunk * i, array1.data() + chunk * i, count);
+			});
+		});
+		BenchResult ("Array::Copy (bandwidth)", time, 2 * bytes, "B");
+		time = BestTime ([&]{ Consume (ParallelReduce::Sum (pool, array1.data(), size)); });
+		BenchResult ("ParallelReduce::Sum", time, bytes, "B");
+		time = BestTime ([&]{ Consume (ParallelReduce::ReproducibleSum (pool, array1.data(), size)); });
+		BenchResult ("ParallelReduce::ReproducibleSum", time, bytes, "B");
+		time = BestTime ([&]{ Consume (ParallelReduce::SumSqr (pool, array1.data(), size)); });
+		BenchResult ("ParallelReduce::SumSqr", time, bytes, "B");
+		time = BestTime ([&]{ Consume (ParallelReduce::ReproducibleSumSqr (pool, array1.data(), size)); });
+		BenchResult ("ParallelReduce::ReproducibleSumSqr", time, bytes, "B");
+		time = BestTime ([&]{ Consume (ParallelReduce::SumMul (pool, array1.data(), array2.data(), size)); });
+		BenchResult ("ParallelReduce::SumMul", time, 2 * bytes, "B");
+		time = BestTime ([&]{ flt64_t min, max; ParallelReduce::MinMax (pool, array1.data(), size, min, max); Consume (min + max); });
+		BenchResult ("ParallelReduce::MinMax", time, bytes, "B");
+	}
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,105 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                       BENCHMARKS FOR THE PARALLEL SORT                       #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<random>
+# include	<algorithm>
+# include	"../ext/ParallelSort.hpp"
+
+# define	SORT_PAIRS_MAX	BENCH_SIZE	// Max count of sorted pairs (10^9 pairs need 40 GB)
+
+//****************************************************************************//
+//      Benchmark the sort of random keys of the target type                  //
+//****************************************************************************//
+template <typename T>
+void BenchParallelSort (
+	const string &type,			// Name of the key type
+	size_t size					// Count of keys
+){
+	// Random keys over the full range of the type
+	vector <T> source (size), array (size), temp (size);
+	mt19937_64 generator (BENCH_SEED);
+	for (T &value : source) {
+		if constexpr (is_floating_point_v <T>)
+			value = uniform_real_distribution <T> (-1.0, 1.0) (generator);
+		else
+			value = static_cast <T> (generator ());
+	}
+	cout << "      type = " << type << endl;
+	auto setup = [&]{ Array::Copy (array.data(), source.data(), size); };
+
+	// Single-threaded sorts
+	double time = BestTime (setup, [&]{ sort (array.begin(), array.end()); });
+	BenchResult ("std::sort", time, size, "keys");
+	time = BestTime (setup, [&]{ Array::RadixSortAsc (array.data(), temp.data(), size); });
+	BenchResult ("Array::RadixSortAsc", time, size, "keys");
+
+	// Scaling with the thread count
+	for (size_t threads : ThreadCounts ()) {
+		ThreadPool pool (threads);
+		cout << "      threads = " << threads << endl;
+		time = BestTime (setup, [&]{ ParallelSort::SortAsc (pool, array.data(), temp.data(), size); });
+		BenchResult ("ParallelSort::SortAsc", time, size, "keys");
+	}
+}
+
+//****************************************************************************//
+//      Benchmark the sort of random keys with pointers                       //
+//****************************************************************************//
+void BenchParallelSortKey (
+	size_t size					// Count of key and pointer pairs
+){
+	// Random 64-bit keys. Each pointer is the index of its key
+	vector <uint64_t> source (size), key (size), tkey (size);
+	vector <const void*> ptr (size), tptr (size);
+	mt19937_64 generator (BENCH_SEED);
+	for (uint64_t &value : source)
+		value = generator ();
+	cout << "      pairs = " << size << endl;
+	auto setup = [&]{
+		Array::Copy (key.data(), source.data(), size);
+		for (size_t i = 0; i < size; i++)
+			ptr[i] = reinterpret_cast <const void*> (i);
+	};
+
+	// Single-threaded sort
+	double time = BestTime (setup, [&]{ Array::RadixSortKeyAsc (key.data(), ptr.data(), tkey.data(), tptr.data(), size); });
+	BenchResult ("Array::RadixSortKeyAsc", time, size, "pairs");
+
+	// Scaling with the thread count
+	for (size_t threads : ThreadCounts ()) {
+		ThreadPool pool (threads);
+		time = BestTime (setup, [&]{ ParallelSort::SortKeyAsc (pool, key.data(), ptr.data(), tkey.data(), tptr.data(), size); });
+		BenchResult ("ParallelSort::SortKeyAsc, threads = " + to_string (threads), time, size, "pairs");
+	}
+}
+
+//****************************************************************************//
+//      Benchmark routine                                                     //
+//****************************************************************************//
+void BenchParallelSort (void) {
+
+	// Show the stage info
+	BenchInfo ("ParallelSort", BENCH_SIZE, BENCH_ROUNDS);
+
+	// Different key types
+	BenchParallelSort <uint32_t> ("uint32_t", BENCH_SIZE);
+	BenchParallelSort <uint64_t> ("uint64_t", BENCH_SIZE);
+	BenchParallelSort <flt64_t> ("flt64_t", BENCH_SIZE);
+
+	// Keys with pointers of growing count
+	for (size_t size = SORT_PAIRS_MAX / 100; size <= SORT_PAIRS_MAX; size *= 10)
+		BenchParallelSortKey (size);
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,63 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                       DATA PATTERNS FOR THE BENCHMARKS                       #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<random>
+# include	<vector>
+# include	<Array.h>
+# include	<BitField.h>
+
+using namespace std;
+
+//****************************************************************************//
+//      Generate a dense bit field with the target density of set bits        //
+//****************************************************************************//
+void RandomBits (
+	vector <uint64_t> &array,	// Bit field
+	double density,				// Fraction of set bits
+	size_t run					// Average run length (0 for independent bits)
+){
+	const size_t bits = array.size() * 64;
+	mt19937_64 generator (BENCH_SEED);
+	if (run) {
+
+		// Alternate intervals of set and reset bits with the target mean length
+		Array::Init (array.data(), array.size(), static_cast <uint64_t> (0));
+		exponential_distribution <double> set_len (1.0 / run);
+		exponential_distribution <double> reset_len (density / ((1.0 - density) * run));
+		size_t pos = 0;
+		while (pos < bits) {
+			pos += static_cast <size_t> (reset_len (generator));
+			const size_t end = min (bits, pos + 1 + static_cast <size_t> (set_len (generator)));
+			if (pos < end)
+				BitField::SetBits (array.data(), pos, end);
+			pos = end;
+		}
+	}
+	else {
+
+		// Scatter the minority bits over the uniform background
+		const bool dense = density > 0.5;
+		const size_t count = static_cast <size_t> ((dense ? 1.0 - density : density) * bits);
+		uniform_int_distribution <size_t> position (0, bits - 1);
+		Array::Init (array.data(), array.size(), dense ? ~static_cast <uint64_t> (0) : 0);
+		for (size_t i = 0; i < count; i++) {
+			if (dense)
+				BitField::ResetBit (array.data(), position (generator));
+			else
+				BitField::SetBit (array.data(), position (generator));
+		}
+	}
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
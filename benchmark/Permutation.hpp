@@ -0,0 +1,75 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                     BENCHMARKS FOR THE SORT PERMUTATIONS                     #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<random>
+# include	<numeric>
+# include	<algorithm>
+# include	"../ext/Permutation.hpp"
+
+# define	GATHER_SIZE		(4 * BENCH_SIZE)	// Column size of the gather (far beyond the TLB reach)
+
+//****************************************************************************//
+//      Benchmark routine                                                     //
+//****************************************************************************//
+void BenchPermutation (void) {
+
+	// Show the stage info
+	BenchInfo ("Permutation", BENCH_SIZE, BENCH_ROUNDS);
+
+	// Random 64-bit keys
+	vector <uint64_t> key (BENCH_SIZE);
+	mt19937_64 generator (BENCH_SEED);
+	for (size_t i = 0; i < BENCH_SIZE; i++)
+		key[i] = generator ();
+	vector <size_t> index (BENCH_SIZE);
+
+	// Stable sort of the indices with a key comparator
+	double time = BestTime ([&]{
+		iota (index.begin(), index.end(), 0);
+	}, [&]{
+		stable_sort (index.begin(), index.end(), [&](size_t a, size_t b){
+			return key[a] < key[b];
+		});
+	});
+	BenchResult ("std::stable_sort (indices)", time, BENCH_SIZE, "keys");
+
+	// Radix key sort of the indices
+	time = BestTime ([&]{ Permutation::ArgsortAsc (index.data(), key.data(), BENCH_SIZE); });
+	BenchResult ("Permutation::ArgsortAsc", time, BENCH_SIZE, "keys");
+
+	// Random permutation of a large column
+	vector <uint64_t> source (GATHER_SIZE), target (GATHER_SIZE);
+	vector <size_t> perm (GATHER_SIZE);
+	for (size_t i = 0; i < GATHER_SIZE; i++)
+		source[i] = generator ();
+	iota (perm.begin(), perm.end(), 0);
+	shuffle (perm.begin(), perm.end(), generator);
+
+	// Naive indexed loads
+	time = BestTime ([&]{
+		for (size_t i = 0; i < GATHER_SIZE; i++)
+			target[i] = source[perm[i]];
+		Consume (target.data());
+	});
+	BenchResult ("Indexed loads (uint64_t)", time, GATHER_SIZE * sizeof (uint64_t), "bytes");
+
+	// Blocked gather with prefetch
+	time = BestTime ([&]{
+		Permutation::Gather (target.data(), source.data(), perm.data(), GATHER_SIZE);
+		Consume (target.data());
+	});
+	BenchResult ("Permutation::Gather (uint64_t)", time, GATHER_SIZE * sizeof (uint64_t), "bytes");
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
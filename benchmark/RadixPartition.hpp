@@ -0,0 +1,83 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                      BENCHMARKS FOR THE RADIX PARTITION                      #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<random>
+# include	"../ext/RadixPartition.hpp"
+
+//****************************************************************************//
+//      Partition with a direct scatter                                       //
+//****************************************************************************//
+// One thread, no write-combining buffers: the base line of the benchmark
+void DirectPartition (uint64_t target[], const uint64_t key[], size_t size, size_t bits, size_t shift) {
+	const size_t fanout = size_t (1) << bits;
+	vector <size_t> pos (fanout);
+	for (size_t i = 0; i < size; i++)
+		pos[(key[i] >> shift) & (fanout - 1)]++;
+	size_t sum = 0;
+	for (size_t &value : pos) {
+		const size_t count = value;
+		value = sum;
+		sum += count;
+	}
+	for (size_t i = 0; i < size; i++)
+		target[pos[(key[i] >> shift) & (fanout - 1)]++] = key[i];
+}
+
+//****************************************************************************//
+//      Benchmark routine                                                     //
+//****************************************************************************//
+void BenchRadixPartition (void) {
+
+	// Show the stage info
+	BenchInfo ("RadixPartition", BENCH_SIZE, BENCH_ROUNDS);
+
+	// Random 64-bit keys partitioned by the top bits. Each pointer is the index
+	// of its key
+	vector <uint64_t> key (BENCH_SIZE), target (BENCH_SIZE);
+	vector <const void*> ptr (BENCH_SIZE), ptarget (BENCH_SIZE);
+	vector <size_t> bounds (4097);
+	mt19937_64 generator (BENCH_SEED);
+	for (size_t i = 0; i < BENCH_SIZE; i++) {
+		key[i] = generator ();
+		ptr[i] = reinterpret_cast <const void*> (i);
+	}
+
+	// Fanouts from 16 to 4096 partitions
+	for (size_t bits = 4; bits <= 12; bits += 2) {
+		const size_t shift = 64 - bits;
+		cout << "      fanout = " << (size_t (1) << bits) << endl;
+		double time = BestTime ([&]{
+			DirectPartition (target.data(), key.data(), BENCH_SIZE, bits, shift);
+			Consume (target[0]);
+		});
+		BenchResult ("Direct scatter", time, BENCH_SIZE, "keys");
+
+		// Scaling with the thread count
+		for (size_t threads : ThreadCounts ()) {
+			ThreadPool pool (threads);
+			time = BestTime ([&]{
+				RadixPartition::Partition (pool, target.data(), key.data(), BENCH_SIZE, bits, shift, bounds.data());
+				Consume (target[0]);
+			});
+			BenchResult ("RadixPartition::Partition, threads = " + to_string (threads), time, BENCH_SIZE, "keys");
+			time = BestTime ([&]{
+				RadixPartition::PartitionKey (pool, target.data(), ptarget.data(), key.data(), ptr.data(), BENCH_SIZE, bits, shift, bounds.data());
+				Consume (target[0]);
+			});
+			BenchResult ("RadixPartition::PartitionKey, threads = " + to_string (threads), time, BENCH_SIZE, "pairs");
+		}
+	}
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
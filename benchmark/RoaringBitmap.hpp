@@ -0,0 +1,105 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                BENCHMARKS FOR THE COMPRESSED CONTAINER BITMAP                #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	"Patterns.hpp"
+# include	"../ext/RoaringBitmap.hpp"
+
+//****************************************************************************//
+//      Benchmark the compressed bitmap against the dense bit field           //
+//****************************************************************************//
+void BenchRoaringBitmap (
+	double density,				// Fraction of set bits
+	size_t run					// Average run length (0 for independent bits)
+){
+	const size_t bits = BENCH_SIZE * 8;
+	vector <uint64_t> array (bits / 64);
+	RandomBits (array, density, run);
+
+	// Compress the bit field
+	RoaringBitmap bitmap (array.data(), bits);
+	bitmap.Optimize ();
+	const size_t count = bitmap.CountBits ();
+
+	// Memory footprint
+	cout << "      density = " << density << ", run = " << run << ": dense " << array.size() * sizeof (uint64_t);
+	cout << " bytes, compressed " << bitmap.Memory() << " bytes (";
+	cout << bitmap.Containers (RoaringBitmap::ARRAY) << " array, ";
+	cout << bitmap.Containers (RoaringBitmap::BITMAP) << " bitmap, ";
+	cout << bitmap.Containers (RoaringBitmap::RUN) << " run containers)" << endl;
+
+	// Bit counting
+	double time = BestTime ([&]{ Consume (BitField::CountBits (array.data(), 0, bits)); });
+	BenchResult ("BitField::CountBits", time, bits, "bits");
+	time = BestTime ([&]{ Consume (bitmap.CountBits (0, bits)); });
+	BenchResult ("RoaringBitmap::CountBits", time, bits, "bits");
+
+	// Iteration over all the set bits
+	time = BestTime ([&]{
+		size_t pos = BitField::FindSetBitFwd (array.data(), 0, bits);
+		while (pos != RoaringBitmap::NOT_FOUND)
+			pos = BitField::FindSetBitFwd (array.data(), pos + 1, bits);
+		Consume (pos);
+	});
+	BenchResult ("BitField::FindSetBitFwd (scan)", time, count, "pos");
+	time = BestTime ([&]{
+		size_t pos = bitmap.FindSetBitFwd (0, bits);
+		while (pos != RoaringBitmap::NOT_FOUND)
+			pos = bitmap.FindSetBitFwd (pos + 1, bits);
+		Consume (pos);
+	});
+	BenchResult ("RoaringBitmap::FindSetBitFwd (scan)", time, count, "pos");
+
+	// Random point lookups
+	vector <size_t> lookups (BENCH_SIZE / 10);
+	mt19937_64 generator (BENCH_SEED);
+	uniform_int_distribution <size_t> position (0, bits - 1);
+	for (size_t &pos : lookups)
+		pos = position (generator);
+	time = BestTime ([&]{
+		size_t found = 0;
+		for (size_t pos : lookups)
+			found += BitField::GetBit (array.data(), pos);
+		Consume (found);
+	});
+	BenchResult ("BitField::GetBit", time, lookups.size(), "lookups");
+	time = BestTime ([&]{
+		size_t found = 0;
+		for (size_t pos : lookups)
+			found += bitmap.GetBit (pos);
+		Consume (found);
+	});
+	BenchResult ("RoaringBitmap::GetBit", time, lookups.size(), "lookups");
+}
+
+//****************************************************************************//
+//      Benchmark routine                                                     //
+//****************************************************************************//
+void BenchRoaringBitmap (void) {
+
+	// Show the stage info
+	BenchInfo ("RoaringBitmap", BENCH_SIZE * 8, BENCH_ROUNDS);
+
+	// Independent bits of different density
+	BenchRoaringBitmap (0.0001, 0);
+	BenchRoaringBitmap (0.01, 0);
+	BenchRoaringBitmap (0.1, 0);
+	BenchRoaringBitmap (0.5, 0);
+	BenchRoaringBitmap (0.99, 0);
+
+	// Long intervals of set bits
+	BenchRoaringBitmap (0.1, 1000);
+	BenchRoaringBitmap (0.5, 1000);
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,82 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                    BENCHMARKS FOR THE STATIC SEARCH TREES                    #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<random>
+# include	<algorithm>
+# include	"../ext/SearchTree.hpp"
+
+# define	SEARCH_QUERIES	1000000		// Count of random queries
+
+//****************************************************************************//
+//      Benchmark the searches in a sorted array of the size                  //
+//****************************************************************************//
+template <typename T>
+void BenchSearchTree (
+	size_t size					// Count of keys
+){
+	// Sorted random keys and random queries over the same range
+	vector <T> array (size), query (SEARCH_QUERIES);
+	mt19937_64 generator (BENCH_SEED);
+	for (T &value : array)
+		value = static_cast <T> (generator ());
+	for (T &value : query)
+		value = static_cast <T> (generator ());
+	sort (array.begin(), array.end());
+	cout << "      size = " << size << " (" << size * sizeof (T) / 1024 << " KB)" << endl;
+
+	// Binary search of the array
+	double time = BestTime ([&]{
+		size_t sum = 0;
+		for (T value : query)
+			sum += Array::FindGreatOrEqualAsc (array.data(), size, value);
+		Consume (sum);
+	});
+	BenchResult ("Array::FindGreatOrEqualAsc", time, SEARCH_QUERIES, "queries");
+
+	// Eytzinger layout
+	const EytzingerTree <T> eytzinger (array.data(), size);
+	time = BestTime ([&]{
+		size_t sum = 0;
+		for (T value : query)
+			sum += eytzinger.FindGreatOrEqual (value);
+		Consume (sum);
+	});
+	BenchResult ("EytzingerTree::FindGreatOrEqual", time, SEARCH_QUERIES, "queries");
+
+	// Static B+ tree
+	const STree <T> stree (array.data(), size);
+	time = BestTime ([&]{
+		size_t sum = 0;
+		for (T value : query)
+			sum += stree.FindGreatOrEqual (value);
+		Consume (sum);
+	});
+	BenchResult ("STree::FindGreatOrEqual", time, SEARCH_QUERIES, "queries");
+}
+
+//****************************************************************************//
+//      Benchmark routine                                                     //
+//****************************************************************************//
+void BenchSearchTree (void) {
+
+	// Show the stage info
+	BenchInfo ("SearchTree", BENCH_SIZE, BENCH_ROUNDS);
+
+	// Sizes from the cache to far past the last level cache
+	for (size_t size = BENCH_SIZE / 100; size <= 4 * BENCH_SIZE; size *= size < BENCH_SIZE ? 10 : 4)
+		BenchSearchTree <uint32_t> (size);
+	BenchSearchTree <uint64_t> (BENCH_SIZE);
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,72 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#               BENCHMARKS FOR THE SELECTION OF ORDER STATISTICS               #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<random>
+# include	<algorithm>
+# include	"../ext/Selection.hpp"
+
+# define	TOP_K_SMALL		100			// Small count of the top elements (heap path)
+
+//****************************************************************************//
+//      Benchmark the selections against full sorts                           //
+//****************************************************************************//
+void BenchSelection (
+	size_t size					// Count of elements
+){
+	// Random 64-bit values
+	vector <uint64_t> source (size), array (size), temp (size), target (size);
+	mt19937_64 generator (BENCH_SEED);
+	for (size_t i = 0; i < size; i++)
+		source[i] = generator ();
+	cout << "      size = " << size << endl;
+	auto setup = [&]{ Array::Copy (array.data(), source.data(), size); };
+
+	// Full sorts
+	double time = BestTime (setup, [&]{ sort (array.begin(), array.end()); });
+	BenchResult ("std::sort", time, size, "elements");
+	time = BestTime (setup, [&]{ Array::RadixSortAsc (array.data(), temp.data(), size); });
+	BenchResult ("Array::RadixSortAsc", time, size, "elements");
+
+	// Median
+	time = BestTime (setup, [&]{ nth_element (array.begin(), array.begin() + size / 2, array.end()); });
+	BenchResult ("std::nth_element (median)", time, size, "elements");
+	time = BestTime (setup, [&]{ Consume (Selection::NthElement (array.data(), size, size / 2)); });
+	BenchResult ("Selection::NthElement (median)", time, size, "elements");
+
+	// Top elements
+	time = BestTime ([&]{ Selection::SmallestK (target.data(), source.data(), size, TOP_K_SMALL); });
+	BenchResult ("Selection::SmallestK (k = 100)", time, size, "elements");
+	time = BestTime ([&]{ Selection::SmallestK (target.data(), source.data(), size, size / 10); });
+	BenchResult ("Selection::SmallestK (k = size / 10)", time, size, "elements");
+
+	// Percentiles
+	const flt64_t levels[] = {0.01, 0.05, 0.1, 0.25, 0.5, 0.75, 0.9, 0.95, 0.99};
+	time = BestTime (setup, [&]{ Selection::Quantiles (target.data(), array.data(), size, levels, sizeof (levels) / sizeof (levels[0])); });
+	BenchResult ("Selection::Quantiles (9 levels)", time, size, "elements");
+}
+
+//****************************************************************************//
+//      Benchmark routine                                                     //
+//****************************************************************************//
+void BenchSelection (void) {
+
+	// Show the stage info
+	BenchInfo ("Selection", BENCH_SIZE, BENCH_ROUNDS);
+
+	// Sizes from the cache to the memory (10^9 elements need 32 GB)
+	for (size_t size = BENCH_SIZE / 10; size <= BENCH_SIZE; size *= 10)
+		BenchSelection (size);
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
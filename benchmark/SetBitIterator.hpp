@@ -0,0 +1,73 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                     BENCHMARKS FOR THE SET BIT ITERATOR                      #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	"Patterns.hpp"
+# include	"../ext/SetBitIterator.hpp"
+
+//****************************************************************************//
+//      Benchmark the set bit iterator against the repeated search calls      //
+//****************************************************************************//
+void BenchSetBitIterator (
+	double density				// Fraction of set bits
+){
+	const size_t bits = BENCH_SIZE * 8;
+	vector <uint64_t> array (bits / 64);
+	RandomBits (array, density, 0);
+	const size_t count = BitField::CountBits (array.data(), 0, bits);
+	vector <size_t> positions (count);
+	cout << "      density = " << density << endl;
+
+	// One search call per set bit
+	double time = BestTime ([&]{
+		size_t sum = 0;
+		size_t pos = BitField::FindSetBitFwd (array.data(), 0, bits);
+		while (pos != SetBitIterator::NOT_FOUND) {
+			sum += pos;
+			pos = BitField::FindSetBitFwd (array.data(), pos + 1, bits);
+		}
+		Consume (sum);
+	});
+	BenchResult ("BitField::FindSetBitFwd (scan)", time, count, "pos");
+
+	// Iterator
+	time = BestTime ([&]{
+		size_t sum = 0;
+		ForEachSetBit (array.data(), 0, bits, [&](size_t pos){ sum += pos; });
+		Consume (sum);
+	});
+	BenchResult ("ForEachSetBit", time, count, "pos");
+
+	// Materialization of row IDs
+	time = BestTime ([&]{ Consume (ExtractSetBits (positions.data(), array.data(), 0, bits)); });
+	BenchResult ("ExtractSetBits", time, count, "pos");
+}
+
+//****************************************************************************//
+//      Benchmark routine                                                     //
+//****************************************************************************//
+void BenchSetBitIterator (void) {
+
+	// Show the stage info
+	BenchInfo ("SetBitIterator", BENCH_SIZE * 8, BENCH_ROUNDS);
+
+	// Independent bits of different density
+	BenchSetBitIterator (0.0001);
+	BenchSetBitIterator (0.001);
+	BenchSetBitIterator (0.01);
+	BenchSetBitIterator (0.1);
+	BenchSetBitIterator (0.5);
+	BenchSetBitIterator (0.9);
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
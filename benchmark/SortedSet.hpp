@@ -0,0 +1,92 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                 BENCHMARKS FOR THE OPERATIONS ON SORTED SETS                 #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<random>
+# include	<algorithm>
+# include	"../ext/SortedSet.hpp"
+
+//****************************************************************************//
+//      Sorted set of random IDs in the range [0, 4 * BENCH_SIZE)             //
+//****************************************************************************//
+vector <uint64_t> RandomSet (size_t size, mt19937_64 &generator) {
+	vector <uint64_t> set (size);
+	for (uint64_t &value : set)
+		value = generator () % (4 * BENCH_SIZE);
+	sort (set.begin(), set.end());
+	set.erase (unique (set.begin(), set.end()), set.end());
+	return set;
+}
+
+//****************************************************************************//
+//      Benchmark routine                                                     //
+//****************************************************************************//
+void BenchSortedSet (void) {
+
+	// Show the stage info
+	BenchInfo ("SortedSet", BENCH_SIZE, BENCH_ROUNDS);
+
+	// Large set of IDs
+	mt19937_64 generator (BENCH_SEED);
+	const vector <uint64_t> large = RandomSet (BENCH_SIZE, generator);
+	vector <uint64_t> target (2 * BENCH_SIZE);
+
+	// Size ratios from 1:1 to 1:10^5
+	for (size_t ratio = 1; ratio <= 100000; ratio *= 10) {
+		const vector <uint64_t> small = RandomSet (BENCH_SIZE / ratio, generator);
+		const size_t amount = small.size() + large.size();
+		cout << "      ratio = 1:" << ratio << endl;
+
+		// Intersection
+		double time = BestTime ([&]{ Consume (set_intersection (small.begin(), small.end(), large.begin(), large.end(), target.begin())); });
+		BenchResult ("std::set_intersection", time, amount, "elements");
+		time = BestTime ([&]{ Consume (SortedSet::Intersection (target.data(), small.data(), small.size(), large.data(), large.size(), SortedSet::MERGE)); });
+		BenchResult ("SortedSet::Intersection (merge)", time, amount, "elements");
+		time = BestTime ([&]{ Consume (SortedSet::Intersection (target.data(), small.data(), small.size(), large.data(), large.size(), SortedSet::GALLOP)); });
+		BenchResult ("SortedSet::Intersection (gallop)", time, amount, "elements");
+
+		// Union
+		time = BestTime ([&]{ Consume (set_union (small.begin(), small.end(), large.begin(), large.end(), target.begin())); });
+		BenchResult ("std::set_union", time, amount, "elements");
+		time = BestTime ([&]{ Consume (SortedSet::Union (target.data(), small.data(), small.size(), large.data(), large.size())); });
+		BenchResult ("SortedSet::Union", time, amount, "elements");
+
+		// Difference of the large set and the small set
+		time = BestTime ([&]{ Consume (set_difference (large.begin(), large.end(), small.begin(), small.end(), target.begin())); });
+		BenchResult ("std::set_difference", time, amount, "elements");
+		time = BestTime ([&]{ Consume (SortedSet::Difference (target.data(), large.data(), large.size(), small.data(), small.size())); });
+		BenchResult ("SortedSet::Difference", time, amount, "elements");
+	}
+
+	// Intersection of four sets of different sizes
+	vector <vector <uint64_t>> sets;
+	for (size_t ratio : {1, 3, 10, 1000})
+		sets.push_back (RandomSet (BENCH_SIZE / ratio, generator));
+	const uint64_t* pointers[] = {sets[0].data(), sets[1].data(), sets[2].data(), sets[3].data()};
+	const size_t sizes[] = {sets[0].size(), sets[1].size(), sets[2].size(), sets[3].size()};
+	const size_t amount = sizes[0] + sizes[1] + sizes[2] + sizes[3];
+	cout << "      k-way" << endl;
+	double time = BestTime ([&]{
+		vector <uint64_t> result (sets[3]), next (sets[3].size());
+		for (size_t k = 0; k < 3; k++) {
+			next.resize (set_intersection (result.begin(), result.end(), sets[k].begin(), sets[k].end(), next.begin()) - next.begin());
+			result.swap (next);
+		}
+		Consume (result.size());
+	});
+	BenchResult ("std::set_intersection (4 sets)", time, amount, "elements");
+	time = BestTime ([&]{ Consume (SortedSet::Intersection (target.data(), pointers, sizes, 4)); });
+	BenchResult ("SortedSet::Intersection (4 sets)", time, amount, "elements");
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,142 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                    UNIT TESTS FOR THE BITMAP QUERY ENGINE                    #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	"Patterns.hpp"
+# include	"../ext/BitmapQuery.hpp"
+
+//****************************************************************************//
+//      Test expressions and their reference implementations                  //
+//****************************************************************************//
+
+// a AND b
+size_t QueryAnd (BitmapQuery &query, const uint64_t *leaf[]) {
+	return query.And (query.Leaf (leaf[0]), query.Leaf (leaf[1]));
+}
+uint64_t QueryAnd (const uint64_t *leaf[], size_t index) {
+	return leaf[0][index] & leaf[1][index];
+}
+
+// a OR NOT b
+size_t QueryOrNot (BitmapQuery &query, const uint64_t *leaf[]) {
+	return query.Or (query.Leaf (leaf[0]), query.Not (query.Leaf (leaf[1])));
+}
+uint64_t QueryOrNot (const uint64_t *leaf[], size_t index) {
+	return leaf[0][index] | ~leaf[1][index];
+}
+
+// (a XOR b) AND NOT c
+size_t QueryXorAndNot (BitmapQuery &query, const uint64_t *leaf[]) {
+	size_t x = query.Xor (query.Leaf (leaf[0]), query.Leaf (leaf[1]));
+	return query.And (x, query.Not (query.Leaf (leaf[2])));
+}
+uint64_t QueryXorAndNot (const uint64_t *leaf[], size_t index) {
+	return (leaf[0][index] ^ leaf[1][index]) & ~leaf[2][index];
+}
+
+// NOT (a OR b) OR (b AND c)
+size_t QueryNorOrAnd (BitmapQuery &query, const uint64_t *leaf[]) {
+	size_t x = query.Not (query.Or (query.Leaf (leaf[0]), query.Leaf (leaf[1])));
+	return query.Or (x, query.And (query.Leaf (leaf[1]), query.Leaf (leaf[2])));
+}
+uint64_t QueryNorOrAnd (const uint64_t *leaf[], size_t index) {
+	return ~(leaf[0][index] | leaf[1][index]) | (leaf[1][index] & leaf[2][index]);
+}
+
+// a AND (b OR (c AND NOT a))
+size_t QueryNested (BitmapQuery &query, const uint64_t *leaf[]) {
+	size_t a = query.Leaf (leaf[0]);
+	size_t x = query.And (query.Leaf (leaf[2]), query.Not (a));
+	return query.And (a, query.Or (query.Leaf (leaf[1]), x));
+}
+uint64_t QueryNested (const uint64_t *leaf[], size_t index) {
+	return leaf[0][index] & (leaf[1][index] | (leaf[2][index] & ~leaf[0][index]));
+}
+
+//****************************************************************************//
+//      Test function for bitmap queries                                      //
+//****************************************************************************//
+void TestBitmapQuery (
+	size_t (*build)(BitmapQuery &query, const uint64_t *leaf[]),
+	uint64_t (*ref)(const uint64_t *leaf[], size_t index),
+	void (*fill)(RandomArray <uint64_t> &array)
+){
+	// Create the source bitmaps and the result arrays of the target size
+	RandomArray <uint64_t> a (BUFFER_SIZE, SEED, MAX_VALUE);
+	RandomArray <uint64_t> b (BUFFER_SIZE, SEED + 1, MAX_VALUE);
+	RandomArray <uint64_t> c (BUFFER_SIZE, SEED + 2, MAX_VALUE);
+	RandomArray <uint64_t> result (BUFFER_SIZE, SEED, MAX_VALUE);
+	RandomArray <uint64_t> reference (BUFFER_SIZE, SEED, MAX_VALUE);
+	const uint64_t *leaf[] = {a.Data(), b.Data(), c.Data()};
+
+	// Run the test in many rounds with a random bitmap size
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random size of the bitmaps
+		size_t size = RandomBitPos (a);
+		size_t words = (size + 63) / 64;
+
+		// Do many tries with the same size, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the source bitmaps with the different bit patterns
+			fill (a);
+			FillDense (b);
+			FillRuns (c);
+
+			// Build the expression tree
+			BitmapQuery query;
+			size_t root = build (query, leaf);
+
+			// Evaluate the expression. Both the testing and the reference
+			size_t count = query.Evaluate (root, result.Data(), size);
+			for (size_t k = 0; k < words; k++)
+				reference.Data()[k] = ref (leaf, k);
+			if (words)
+				ResetBits (reference.Data(), size, words * 64);
+
+			// Compare the result bitmaps
+			if (words)
+				result.CheckValues (reference, words);
+
+			// Compare the count and the position of the first matching bit
+			result.CheckResult (count, CountBits (reference.Data(), 0, size), EPSILON);
+			result.CheckResult (query.Count (root, size), CountBits (reference.Data(), 0, size), EPSILON);
+			result.CheckResult (query.FindFirst (root, size), FindSetBitFwd (reference.Data(), 0, size), EPSILON);
+		}
+	}
+}
+
+//****************************************************************************//
+//      Unit test routines                                                    //
+//****************************************************************************//
+
+//============================================================================//
+//      Boolean queries over bitmaps                                          //
+//============================================================================//
+void TestBitmapQuery (void) {
+
+	// Show the stage info
+	StageInfo ("BitmapQuery::Evaluate", BUFFER_SIZE, ROUNDS, TRIES);
+
+	// Sparse, dense and run patterns of the first operand
+	for (auto fill : {FillSparse, FillDense, FillRuns}) {
+		TestBitmapQuery (QueryAnd, QueryAnd, fill);
+		TestBitmapQuery (QueryOrNot, QueryOrNot, fill);
+		TestBitmapQuery (QueryXorAndNot, QueryXorAndNot, fill);
+		TestBitmapQuery (QueryNorOrAnd, QueryNorOrAnd, fill);
+		TestBitmapQuery (QueryNested, QueryNested, fill);
+	}
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
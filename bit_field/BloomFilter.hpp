@@ -0,0 +1,97 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                       UNIT TESTS FOR THE BLOOM FILTER                        #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	"../ext/BloomFilter.hpp"
+
+# define	BLOOM_BITS_PER_KEY	10		// Filter bits per inserted key
+# define	BLOOM_HASHES		7		// Bits per key (optimal for 10 bits per key)
+
+//****************************************************************************//
+//      Test function for the Bloom filter                                    //
+//****************************************************************************//
+void TestBloomFilter (
+	bool blocked				// Cache line local bits
+){
+	// Create arrays of the keys and the membership flags
+	RandomArray <uint64_t> array (BUFFER_SIZE, SEED, MAX_VALUE);
+	RandomArray <uint64_t> keys (BUFFER_SIZE, SEED, MAX_VALUE);
+	RandomArray <uint64_t> others (BUFFER_SIZE, SEED, MAX_VALUE);
+	RandomArray <bool> flags (BUFFER_SIZE, SEED, true);
+
+	// Run the test in many rounds with a random count of keys
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random number of keys to work with
+		size_t count = array.Count (0);
+		size_t base = array.Offset () * BUFFER_SIZE;
+
+		// Do many tries with the same count of keys, but different filters
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Generate distinct inserted keys and keys which are not in the set
+			for (size_t k = 0; k < BUFFER_SIZE; k++) {
+				keys.Data()[k] = 2 * (base + k) + j * 4 * BUFFER_SIZE * BUFFER_SIZE;
+				others.Data()[k] = keys.Data()[k] + 1;
+			}
+
+			// Fill the filters. Both the batched and the single key
+			BloomFilter filter (max <size_t> (count, 1) * BLOOM_BITS_PER_KEY, BLOOM_HASHES, blocked, j % 2);
+			BloomFilter single (max <size_t> (count, 1) * BLOOM_BITS_PER_KEY, BLOOM_HASHES, blocked, j % 2);
+			filter.Insert (keys.Data(), count);
+			for (size_t k = 0; k < count; k++)
+				single.Insert (keys.Data()[k]);
+
+			// Both ways should set the same bits
+			array.CheckResult (filter.CountBits (), single.CountBits (), EPSILON);
+
+			// There are no false negatives
+			size_t found = filter.Query (flags.Data(), keys.Data(), count);
+			array.CheckResult (found, count, EPSILON);
+
+			// Batched query should match the single key query
+			found = filter.Query (flags.Data(), others.Data(), BUFFER_SIZE);
+			for (size_t k = 0; k < BUFFER_SIZE; k++)
+				flags.CheckResult (flags.Data()[k], single.Contains (others.Data()[k]), EPSILON);
+
+			// The false positive rate should be close to the theoretical one
+			if (count) {
+				double measured = static_cast <double> (found) / BUFFER_SIZE;
+				double expected = filter.FalsePositiveRate (count);
+				if (measured > 2.0 * expected + 0.005) {
+					throw runtime_error ("    False positive rate is too high: Got '" +
+					to_string (measured) + "' Expected '" + to_string (expected) + "'");
+				}
+			}
+		}
+	}
+}
+
+//****************************************************************************//
+//      Unit test routines                                                    //
+//****************************************************************************//
+
+//============================================================================//
+//      Membership queries                                                    //
+//============================================================================//
+void TestBloomFilter (void) {
+
+	// Show the stage info
+	StageInfo ("BloomFilter::Query", BUFFER_SIZE, ROUNDS, TRIES);
+
+	// Classic and blocked filters
+	TestBloomFilter (false);
+	TestBloomFilter (true);
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,53 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                    BIT PATTERNS FOR THE BITMAP UNIT TESTS                    #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<algorithm>
+# include	<Array.h>
+# include	<BitField.h>
+
+//****************************************************************************//
+//      Bit patterns for the bitmap tests                                     //
+//****************************************************************************//
+
+// Sparse bits
+void FillSparse (RandomArray <uint64_t> &array) {
+	array.Populate ();
+}
+
+// Dense bits
+void FillDense (RandomArray <uint64_t> &array) {
+	array.Populate ();
+	Array::Not (array.Data(), array.Size());
+}
+
+// Long intervals of set bits
+void FillRuns (RandomArray <uint64_t> &array) {
+	const size_t bits = array.Size() * 64;
+	Array::Init (array.Data(), array.Size(), static_cast <uint64_t> (0));
+	for (size_t i = 0; i < MAX_VALUE; i++) {
+		size_t spos = array.Offset () * 64;
+		size_t epos = spos + array.Count (0) * 8;
+		BitField::SetBits (array.Data(), min (spos, bits), min (epos, bits));
+	}
+}
+
+//****************************************************************************//
+//      Generate a random bit position within the bit field                   //
+//****************************************************************************//
+size_t RandomBitPos (const RandomArray <uint64_t> &array) {
+	const size_t bits = array.Size() * 64;
+	return min (array.Offset () * 64 + array.Count (array.Size() - 63), bits);
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
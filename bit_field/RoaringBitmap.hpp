@@ -0,0 +1,238 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                UNIT TESTS FOR THE COMPRESSED CONTAINER BITMAP                #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	"Patterns.hpp"
+# include	"../ext/RoaringBitmap.hpp"
+
+//****************************************************************************//
+//      Test function for bit search operations                               //
+//****************************************************************************//
+template <typename R>
+void TestRoaringSearch (
+	R (RoaringBitmap::*func)(size_t spos, size_t epos) const,
+	R (*ref)(const uint64_t array[], size_t spos, size_t epos),
+	void (*fill)(RandomArray <uint64_t> &array)
+){
+	// Create an array of the target size
+	RandomArray <uint64_t> array (BUFFER_SIZE, SEED, MAX_VALUE);
+	const size_t bits = array.Size() * 64;
+
+	// Run the test in many rounds with random bit positions
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random range of bits to work with
+		size_t spos = RandomBitPos (array);
+		size_t epos = RandomBitPos (array);
+
+		// Do many tries with the same range, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the array with the bit pattern
+			fill (array);
+
+			// Compress the bit field. Both the raw and the optimized containers
+			RoaringBitmap bitmap (array.Data(), bits);
+			RoaringBitmap optimized (bitmap);
+			optimized.Optimize ();
+
+			// Apply the operation to the bitmap data. Both the testing and the reference
+			R computed_value = (bitmap.*func) (spos, epos);
+			R optimized_value = (optimized.*func) (spos, epos);
+			R correct_value = ref (array.Data(), spos, epos);
+
+			// Compare the result values
+			array.CheckResult (computed_value, correct_value, EPSILON);
+			array.CheckResult (optimized_value, correct_value, EPSILON);
+		}
+	}
+}
+
+//****************************************************************************//
+//      Test function for single bit operations                               //
+//****************************************************************************//
+void TestRoaringBit (
+	void (RoaringBitmap::*func)(size_t pos),
+	void (*ref)(uint64_t array[], size_t pos),
+	void (*fill)(RandomArray <uint64_t> &array)
+){
+	// Create an array of the target size
+	RandomArray <uint64_t> array (BUFFER_SIZE, SEED, MAX_VALUE);
+	const size_t bits = array.Size() * 64;
+
+	// Run the test in many rounds with random bit positions
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random bit to work with
+		size_t pos = min (RandomBitPos (array), bits - 1);
+
+		// Do many tries with the same position, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the array with the bit pattern
+			fill (array);
+
+			// Compress the bit field
+			RoaringBitmap bitmap (array.Data(), bits);
+			if (j % 2)
+				bitmap.Optimize ();
+
+			// Apply the operation to the bitmap data. Both the testing and the reference
+			(bitmap.*func) (pos);
+			ref (array.Data(), pos);
+
+			// Check the changed bit
+			array.CheckResult (bitmap.GetBit (pos), GetBit (array.Data(), pos), EPSILON);
+
+			// Compare the decompressed bit field with the reference
+			RandomArray <uint64_t> result (array);
+			bitmap.ToBitField (result.Data(), bits);
+			result.CheckValues (array);
+		}
+	}
+}
+
+//****************************************************************************//
+//      Test function for bit range operations                                //
+//****************************************************************************//
+void TestRoaringBits (
+	void (RoaringBitmap::*func)(size_t spos, size_t epos),
+	void (*ref)(uint64_t array[], size_t spos, size_t epos),
+	void (*fill)(RandomArray <uint64_t> &array)
+){
+	// Create an array of the target size
+	RandomArray <uint64_t> array (BUFFER_SIZE, SEED, MAX_VALUE);
+	const size_t bits = array.Size() * 64;
+
+	// Run the test in many rounds with random bit positions
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random range of bits to work with
+		size_t spos = RandomBitPos (array);
+		size_t epos = RandomBitPos (array);
+
+		// Do many tries with the same range, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the array with the bit pattern
+			fill (array);
+
+			// Compress the bit field
+			RoaringBitmap bitmap (array.Data(), bits);
+			if (j % 2)
+				bitmap.Optimize ();
+
+			// Apply the operation to the bitmap data. Both the testing and the reference
+			(bitmap.*func) (spos, epos);
+			ref (array.Data(), spos, epos);
+
+			// Check the bit count of the changed bitmap
+			array.CheckResult (bitmap.CountBits (), CountBits (array.Data(), 0, bits), EPSILON);
+
+			// Compare the decompressed bit field with the reference
+			RandomArray <uint64_t> result (array);
+			bitmap.ToBitField (result.Data(), bits);
+			result.CheckValues (array);
+		}
+	}
+}
+
+//****************************************************************************//
+//      Unit test routines                                                    //
+//****************************************************************************//
+
+//============================================================================//
+//      Set bit value in a compressed bitmap                                  //
+//============================================================================//
+void TestRoaringSetBit (void) {
+
+	// Show the stage info
+	StageInfo ("RoaringBitmap::SetBit", BUFFER_SIZE, ROUNDS, TRIES);
+
+	// Array, bitmap and run containers
+	TestRoaringBit (&RoaringBitmap::SetBit, SetBit, FillSparse);
+	TestRoaringBit (&RoaringBitmap::SetBit, SetBit, FillDense);
+	TestRoaringBit (&RoaringBitmap::SetBit, SetBit, FillRuns);
+}
+
+//============================================================================//
+//      Reset bit value in a compressed bitmap                                //
+//============================================================================//
+void TestRoaringResetBit (void) {
+
+	// Show the stage info
+	StageInfo ("RoaringBitmap::ResetBit", BUFFER_SIZE, ROUNDS, TRIES);
+
+	// Array, bitmap and run containers
+	TestRoaringBit (&RoaringBitmap::ResetBit, ResetBit, FillSparse);
+	TestRoaringBit (&RoaringBitmap::ResetBit, ResetBit, FillDense);
+	TestRoaringBit (&RoaringBitmap::ResetBit, ResetBit, FillRuns);
+}
+
+//============================================================================//
+//      Set bits in a compressed bitmap range                                 //
+//============================================================================//
+void TestRoaringSetBits (void) {
+
+	// Show the stage info
+	StageInfo ("RoaringBitmap::SetBits", BUFFER_SIZE, ROUNDS, TRIES);
+
+	// Array, bitmap and run containers
+	TestRoaringBits (&RoaringBitmap::SetBits, SetBits, FillSparse);
+	TestRoaringBits (&RoaringBitmap::SetBits, SetBits, FillDense);
+	TestRoaringBits (&RoaringBitmap::SetBits, SetBits, FillRuns);
+}
+
+//============================================================================//
+//      Reset bits in a compressed bitmap range                               //
+//============================================================================//
+void TestRoaringResetBits (void) {
+
+	// Show the stage info
+	StageInfo ("RoaringBitmap::ResetBits", BUFFER_SIZE, ROUNDS, TRIES);
+
+	// Array, bitmap and run containers
+	TestRoaringBits (&RoaringBitmap::ResetBits, ResetBits, FillSparse);
+	TestRoaringBits (&RoaringBitmap::ResetBits, ResetBits, FillDense);
+	TestRoaringBits (&RoaringBitmap::ResetBits, ResetBits, FillRuns);
+}
+
+//============================================================================//
+//      Searching for a set bit in a compressed bitmap                        //
+//============================================================================//
+void TestRoaringFindSetBitFwd (void) {
+
+	// Show the stage info
+	StageInfo ("RoaringBitmap::FindSetBitFwd", BUFFER_SIZE, ROUNDS, TRIES);
+
+	// Array, bitmap and run containers
+	TestRoaringSearch <size_t> (&RoaringBitmap::FindSetBitFwd, FindSetBitFwd, FillSparse);
+	TestRoaringSearch <size_t> (&RoaringBitmap::FindSetBitFwd, FindSetBitFwd, FillDense);
+	TestRoaringSearch <size_t> (&RoaringBitmap::FindSetBitFwd, FindSetBitFwd, FillRuns);
+}
+
+//============================================================================//
+//      Bit counting in a compressed bitmap                                   //
+//============================================================================//
+void TestRoaringCountBits (void) {
+
+	// Show the stage info
+	StageInfo ("RoaringBitmap::CountBits", BUFFER_SIZE, ROUNDS, TRIES);
+
+	// Array, bitmap and run containers
+	TestRoaringSearch <size_t> (&RoaringBitmap::CountBits, CountBits, FillSparse);
+	TestRoaringSearch <size_t> (&RoaringBitmap::CountBits, CountBits, FillDense);
+	TestRoaringSearch <size_t> (&RoaringBitmap::CountBits, CountBits, FillRuns);
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,84 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                     UNIT TESTS FOR THE SET BIT ITERATOR                      #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	"Patterns.hpp"
+# include	"../ext/SetBitIterator.hpp"
+
+//****************************************************************************//
+//      Test function for set bit enumeration                                 //
+//****************************************************************************//
+void TestSetBitIterator (
+	void (*fill)(RandomArray <uint64_t> &array)
+){
+	// Create an array of the target size and the arrays of bit positions
+	RandomArray <uint64_t> array (BUFFER_SIZE, SEED, MAX_VALUE);
+	RandomArray <size_t> computed (BUFFER_SIZE * 64, SEED, MAX_VALUE);
+	RandomArray <size_t> correct (BUFFER_SIZE * 64, SEED, MAX_VALUE);
+
+	// Run the test in many rounds with random bit positions
+	for (size_t i = 0; i < ROUNDS; i++) {
+
+		// Get a random range of bits to work with
+		size_t spos = RandomBitPos (array);
+		size_t epos = RandomBitPos (array);
+
+		// Do many tries with the same range, but different data
+		for (size_t j = 0; j < TRIES; j++) {
+
+			// Populate the array with the bit pattern
+			fill (array);
+
+			// Enumerate set bits with the reference search loop
+			size_t count = 0;
+			size_t pos = FindSetBitFwd (array.Data(), spos, epos);
+			while (pos != SetBitIterator::NOT_FOUND) {
+				correct.Data()[count++] = pos;
+				pos = FindSetBitFwd (array.Data(), pos + 1, epos);
+			}
+
+			// Extract set bits into the array of positions
+			size_t extracted = ExtractSetBits (computed.Data(), array.Data(), spos, epos);
+			computed.CheckResult (extracted, count, EPSILON);
+			if (count)
+				computed.CheckValues (correct, count);
+
+			// Visit set bits with the iterator
+			size_t visited = 0;
+			ForEachSetBit (array.Data(), spos, epos, [&](size_t pos){
+				computed.CheckResult (pos, correct.Data()[visited++], EPSILON);
+			});
+			computed.CheckResult (visited, count, EPSILON);
+		}
+	}
+}
+
+//****************************************************************************//
+//      Unit test routines                                                    //
+//****************************************************************************//
+
+//============================================================================//
+//      Iteration over set bits                                               //
+//============================================================================//
+void TestSetBitIterator (void) {
+
+	// Show the stage info
+	StageInfo ("SetBitIterator::Next", BUFFER_SIZE, ROUNDS, TRIES);
+
+	// Sparse, dense and run patterns
+	TestSetBitIterator (FillSparse);
+	TestSetBitIterator (FillDense);
+	TestSetBitIterator (FillRuns);
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
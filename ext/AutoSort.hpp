@@ -0,0 +1,315 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                    AUTOMATIC CHOICE OF THE SORT ALGORITHM                    #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<random>
+# include	<chrono>
+# include	<vector>
+# include	<algorithm>
+# include	<Array.h>
+
+using namespace std;
+
+//****************************************************************************//
+//      Automatic choice of the sort algorithm                                //
+//****************************************************************************//
+
+// Sorts an array with the Array:: quick sort, merge sort or radix sort,
+// whichever is the fastest for the array. A cheap sample of the array puts it
+// into one of the input classes: presorted, if most of the sampled runs are
+// already in order (Array::CheckSortAsc), with many duplicates, if a sorted
+// sample of the values has few distinct ones, or random otherwise. The kernel
+// to run is then looked up in the crossover table by the input class and the
+// size bucket of the array. Presorted arrays that turn out to be fully sorted
+// are not sorted at all. The default table is a rough guess. Calibrate measures
+// all the kernels on the target machine for the key type and returns the
+// table of the fastest ones, which the sorter of that type should use. Kernels
+// that LinAsm does not provide for the key type are replaced by the radix sort.
+class AutoSort
+{
+//============================================================================//
+//      Types                                                                 //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Sort kernels                                                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	enum Kernel
+	{
+		NONE,					// Array is already sorted
+		QUICK,					// Array::QuickSortAsc / QuickSortDsc
+		MERGE,					// Array::MergeSortAsc / MergeSortDsc
+		RADIX					// Array::RadixSortAsc / RadixSortDsc
+	};
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Input classes                                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	enum Input
+	{
+		RANDOM,					// No visible order
+		PRESORTED,				// Most of the sampled runs are in order
+		DUPLICATES,				// Few distinct values
+		INPUTS					// Count of the input classes
+	};
+
+//============================================================================//
+//      Constants                                                             //
+//============================================================================//
+public:
+	static constexpr size_t BUCKETS = 4;					// Count of the size buckets
+	static constexpr size_t BUCKET_SIZE [BUCKETS] = {		// Min array size of each bucket
+		0, 1 << 10, 1 << 14, 1 << 18
+	};
+	static constexpr size_t SAMPLE_RUNS = 16;				// Count of the sampled runs
+	static constexpr size_t SAMPLE_RUN = 32;				// Count of elements in a sampled run
+	static constexpr size_t SAMPLE_SIZE = 256;				// Count of the sampled values
+	static constexpr double PRESORTED_RUNS = 0.75;			// Min share of the sorted sample runs of presorted arrays
+	static constexpr double DISTINCT_VALUES = 0.25;			// Max share of the distinct sample values of arrays with duplicates
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Crossover table                                                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	struct Table
+	{
+		Kernel	kernel [INPUTS][BUCKETS];	// Fastest kernel by the input class and size bucket
+	};
+
+//============================================================================//
+//      Members                                                               //
+//============================================================================//
+private:
+	Table	table;		// Crossover table
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Kernels of the key type provided by LinAsm                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static constexpr bool HasQuickSort = requires (T *array, size_t size) {
+		Array::QuickSortAsc (array, size);
+		Array::QuickSortDsc (array, size);
+	};
+	template <typename T>
+	static constexpr bool HasMergeSort = requires (T *array, T *temp, size_t size) {
+		Array::MergeSortAsc (array, temp, size);
+		Array::MergeSortDsc (array, temp, size);
+	};
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Replace the kernels that are not provided for the key type            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static Kernel Available (Kernel kernel) {
+		if (kernel == QUICK && !HasQuickSort <T>)
+			return RADIX;
+		if (kernel == MERGE && !HasMergeSort <T>)
+			return RADIX;
+		return kernel;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Size bucket of the array                                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static size_t Bucket (size_t size) {
+		size_t bucket = 0;
+		while (bucket + 1 < BUCKETS && size >= BUCKET_SIZE[bucket + 1])
+			bucket++;
+		return bucket;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Run the kernel                                                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void Run (Kernel kernel, T array[], T temp[], size_t size, bool ascending) {
+		if constexpr (HasQuickSort <T>) {
+			if (kernel == QUICK) {
+				if (ascending)
+					Array::QuickSortAsc (array, size);
+				else
+					Array::QuickSortDsc (array, size);
+				return;
+			}
+		}
+		if constexpr (HasMergeSort <T>) {
+			if (kernel == MERGE) {
+				if (ascending)
+					Array::MergeSortAsc (array, temp, size);
+				else
+					Array::MergeSortDsc (array, temp, size);
+				return;
+			}
+		}
+		if (kernel != NONE) {
+			if (ascending)
+				Array::RadixSortAsc (array, temp, size);
+			else
+				Array::RadixSortDsc (array, temp, size);
+		}
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Constructors                                                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	AutoSort (void) : table {{
+		{QUICK, RADIX, RADIX, RADIX},		// Random arrays
+		{QUICK, MERGE, MERGE, MERGE},		// Presorted arrays
+		{QUICK, QUICK, RADIX, RADIX}		// Arrays with duplicates
+	}} {}
+	AutoSort (const Table &table) : table (table) {}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Crossover table of the sorter                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	const Table& Crossovers (void) const {
+		return table;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Input class of the array                                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static Input Classify (const T array[], size_t size, bool ascending = true) {
+
+		// Small arrays are cheaper to sort than to sample
+		if (size < SAMPLE_RUNS * SAMPLE_RUN)
+			return RANDOM;
+
+		// Count the sampled runs that are already in order
+		size_t sorted = 0;
+		for (size_t i = 0; i < SAMPLE_RUNS; i++) {
+			const T *run = array + (size - SAMPLE_RUN) * i / (SAMPLE_RUNS - 1);
+			const size_t check = ascending ? Array::CheckSortAsc (run, SAMPLE_RUN) : Array::CheckSortDsc (run, SAMPLE_RUN);
+			sorted += check == static_cast <size_t> (-1);
+		}
+		if (sorted >= PRESORTED_RUNS * SAMPLE_RUNS)
+			return PRESORTED;
+
+		// Count the distinct values of the sorted sample
+		T sample [SAMPLE_SIZE], temp [SAMPLE_SIZE];
+		for (size_t i = 0; i < SAMPLE_SIZE; i++)
+			sample[i] = array[size / SAMPLE_SIZE * i];
+		Array::RadixSortAsc (sample, temp, SAMPLE_SIZE);
+		size_t distinct = 1;
+		for (size_t i = 1; i < SAMPLE_SIZE; i++)
+			distinct += sample[i] != sample[i - 1];
+		if (distinct <= DISTINCT_VALUES * SAMPLE_SIZE)
+			return DUPLICATES;
+		return RANDOM;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Kernel to sort the array with                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	Kernel Choose (const T array[], size_t size, bool ascending = true) const {
+		const Input input = Classify (array, size, ascending);
+		if (input == PRESORTED) {
+			const size_t check = ascending ? Array::CheckSortAsc (array, size) : Array::CheckSortDsc (array, size);
+			if (check == static_cast <size_t> (-1))
+				return NONE;
+		}
+		return Available <T> (table.kernel[input][Bucket (size)]);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Ascending sort order                                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Returns the kernel the array was sorted with
+	template <typename T>
+	Kernel SortAsc (T array[], T temp[], size_t size) const {
+		const Kernel kernel = Choose (array, size, true);
+		Run (kernel, array, temp, size, true);
+		return kernel;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Descending sort order                                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	Kernel SortDsc (T array[], T temp[], size_t size) const {
+		const Kernel kernel = Choose (array, size, false);
+		Run (kernel, array, temp, size, false);
+		return kernel;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Fill the array with the values of the input class                     //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Random values, random values modulo 16 or sorted values with 1% of them
+	// swapped at random
+	template <typename T>
+	static void Generate (T array[], size_t size, Input input, mt19937_64 &generator) {
+		for (size_t i = 0; i < size; i++)
+			array[i] = static_cast <T> (input == DUPLICATES ? generator () % 16 : generator () >> 16);
+		if (input == PRESORTED) {
+			sort (array, array + size);
+			for (size_t i = 0; i < size / 100; i++)
+				swap (array[generator () % size], array[generator () % size]);
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Measure the crossover table on this machine                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Each kernel sorts generated arrays of each input class and of the min
+	// size of each bucket (the smallest bucket uses SAMPLE_RUNS * SAMPLE_RUN
+	// elements), and the fastest one wins the cell. Small arrays are sorted
+	// many times per round to get measurable times
+	template <typename T>
+	static Table Calibrate (size_t rounds = 3, size_t seed = 100) {
+		Table result;
+		mt19937_64 generator (seed);
+		for (size_t input = 0; input < INPUTS; input++) {
+			for (size_t bucket = 0; bucket < BUCKETS; bucket++) {
+				const size_t size = max (BUCKET_SIZE[bucket], SAMPLE_RUNS * SAMPLE_RUN);
+				const size_t repeats = max <size_t> (1, (1 << 20) / size);
+				vector <T> source (size), array (size), temp (size);
+				Generate (source.data(), size, static_cast <Input> (input), generator);
+				double best = 0.0;
+				result.kernel[input][bucket] = RADIX;
+				for (Kernel kernel : {QUICK, MERGE, RADIX}) {
+					if (Available <T> (kernel) != kernel)
+						continue;
+					for (size_t i = 0; i < rounds; i++) {
+						auto start = chrono::steady_clock::now();
+						for (size_t j = 0; j < repeats; j++) {
+							Array::Copy (array.data(), source.data(), size);
+							Run (kernel, array.data(), temp.data(), size, true);
+						}
+						auto stop = chrono::steady_clock::now();
+						const double time = chrono::duration <double> (stop - start).count();
+						if (best == 0.0 || time < best) {
+							best = time;
+							result.kernel[input][bucket] = kernel;
+						}
+					}
+				}
+			}
+		}
+		return result;
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,94 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                      BATCHED COUNTING IN SORTED ARRAYS                       #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<vector>
+# include	<Array.h>
+# include	"Gallop.hpp"
+# include	"Permutation.hpp"
+
+using namespace std;
+
+//****************************************************************************//
+//      Batched counting in sorted arrays                                     //
+//****************************************************************************//
+
+// Counts the occurrences of many values in one sorted array, like a call of
+// Array::CountAsc or CountDsc per value, but the queries are visited in the
+// sort order of the array. The query order comes from the Array:: radix key
+// sort (Permutation::ArgsortAsc), so equal queries are counted once, and each
+// range of equal elements is found by galloping forward from the end of the
+// previous range (Gallop::Bound). The sweep reads the array once in order, so a
+// batch of m queries costs O(m log(n / m)) instead of O(m log n) random
+// accesses.
+class BatchCount
+{
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count the values in the sort order of the array                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void Count (
+		size_t count[],			// Target array of the counts
+		const T array[],		// Sorted array
+		size_t size,			// Count of elements in the array
+		const T values[],		// Values to count
+		size_t queries,			// Count of values
+		bool ascending			// Sort order of the array
+	){
+		vector <size_t> order (queries);
+		if (ascending)
+			Permutation::ArgsortAsc (order.data(), values, queries);
+		else
+			Permutation::ArgsortDsc (order.data(), values, queries);
+		size_t pos = 0;
+		for (size_t k = 0; k < queries; k++) {
+			const T value = values[order[k]];
+			if (k > 0 && value == values[order[k - 1]]) {
+				count[order[k]] = count[order[k - 1]];
+				continue;
+			}
+			const size_t first = Gallop::Bound (array, size, pos, value, false, ascending);
+			const size_t last = Gallop::Bound (array, size, first, value, true, ascending);
+			count[order[k]] = last - first;
+			pos = last;
+		}
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Ascending sort order                                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void CountAsc (size_t count[], const T array[], size_t size, const T values[], size_t queries) {
+		Count (count, array, size, values, queries, true);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Descending sort order                                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void CountDsc (size_t count[], const T array[], size_t size, const T values[], size_t queries) {
+		Count (count, array, size, values, queries, false);
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,91 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                       BATCH INSERT INTO SORTED ARRAYS                        #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<vector>
+# include	<Array.h>
+
+using namespace std;
+
+//****************************************************************************//
+//      Batch insert into sorted arrays                                       //
+//****************************************************************************//
+
+// Inserts a batch of values into a sorted array that has room for them at its
+// end, instead of appending them and sorting the whole array again. The batch
+// is sorted first. Then its values are placed from the last one to the first
+// one: the binary search of the Array:: library finds where the value goes in
+// the part of the array that is not moved yet, and the elements after that
+// position are moved up by Array::Move straight to their final places. Each
+// element of the array moves once, and no temporary copy of the array is made.
+// The inserted values follow the equal elements that were already in the array.
+class BatchInsert
+{
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Merge the sorted batch into the array from the end                    //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static size_t Merge (
+		T array[],				// Sorted array with room for the batch at its end
+		size_t size,			// Count of elements in the array
+		const T batch[],		// Sorted batch of values
+		size_t count,			// Count of values in the batch
+		size_t (*find)(const T array[], size_t size, T value)
+	){
+		size_t end = size;
+		for (size_t k = count; k > 0; k--) {
+			const T value = batch[k - 1];
+			size_t pos = find (array, end, value);
+			if (pos == static_cast <size_t> (-1))
+				pos = end;
+			Array::Move (array + pos + k, array + pos, end - pos);
+			array[pos + k - 1] = value;
+			end = pos;
+		}
+		return size + count;
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Ascending sort order                                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Sorts the batch and returns the new count of elements in the array
+	template <typename T>
+	static size_t InsertAsc (T array[], size_t size, T batch[], size_t count) {
+		vector <T> temp (count);
+		Array::RadixSortAsc (batch, temp.data(), count);
+		return Merge (array, size, batch, count, Array::FindGreatAsc);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Descending sort order                                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Sorts the batch and returns the new count of elements in the array
+	template <typename T>
+	static size_t InsertDsc (T array[], size_t size, T batch[], size_t count) {
+		vector <T> temp (count);
+		Array::RadixSortDsc (batch, temp.data(), count);
+		return Merge (array, size, batch, count, Array::FindLessDsc);
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
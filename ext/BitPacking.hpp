@@ -0,0 +1,295 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                          BIT-PACKED INTEGER ARRAYS                           #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<Array.h>
+# include	<vector>
+# include	<type_traits>
+# include	<utility>
+# include	<stdexcept>
+
+using namespace std;
+
+//****************************************************************************//
+//      Bit packing kernels                                                   //
+//****************************************************************************//
+
+// Integers of k bits (1 <= k <= 64) are stored back to back in 64-bit words
+// starting from the lowest bit. A value may straddle two adjacent words.
+class BitPacking
+{
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Mask of the lowest bits                                               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static uint64_t Mask (size_t bits) {
+		return bits < 64 ? (static_cast <uint64_t> (1) << bits) - 1 : ~static_cast <uint64_t> (0);
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count of 64-bit words to hold the packed values                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static size_t Words (size_t size, size_t bits) {
+		return (size * bits + 63) / 64;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Minimal width of the values in bits (at least 1)                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static size_t Width (const T array[], size_t size) {
+		uint64_t all = 0;
+		for (size_t i = 0; i < size; i++)
+			all |= static_cast <make_unsigned_t <T>> (array[i]);
+		return all ? 64 - __builtin_clzll (all) : 1;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Pack the lowest bits of the values                                    //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void Pack (
+		uint64_t target[],		// Packed words
+		const T source[],		// Values to pack
+		size_t size,			// Count of values
+		size_t bits				// Width of a value in bits
+	){
+		const uint64_t mask = Mask (bits);
+		uint64_t word = 0;
+		size_t fill = 0;
+		size_t index = 0;
+		for (size_t i = 0; i < size; i++) {
+			const uint64_t value = static_cast <make_unsigned_t <T>> (source[i]) & mask;
+			word |= value << fill;
+			fill += bits;
+			if (fill >= 64) {
+				target[index++] = word;
+				fill -= 64;
+				word = fill ? value >> (bits - fill) : 0;
+			}
+		}
+		if (fill)
+			target[index] = word;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Unpack a group of 64 values of the fixed width                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+// The shifts are known at compile time, so the loop is unrolled into a
+// straight sequence of shifts and masks over BITS words
+	template <size_t BITS, typename T>
+	static void UnpackGroup (T target[], const uint64_t source[]) {
+		constexpr uint64_t mask = BITS < 64 ? (static_cast <uint64_t> (1) << (BITS % 64)) - 1 : ~static_cast <uint64_t> (0);
+# pragma	GCC unroll 64
+		for (size_t i = 0; i < 64; i++) {
+			const size_t index = i * BITS / 64;
+			const size_t shift = i * BITS % 64;
+			uint64_t value = source[index] >> shift;
+			if (shift + BITS > 64)
+				value |= source[index + 1] << (64 - shift) % 64;
+			target[i] = static_cast <T> (value & mask);
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Table of the group unpacking functions for all the widths             //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T, size_t... BITS>
+	static auto GroupTable (index_sequence <BITS...>) {
+		using Group = void (*)(T target[], const uint64_t source[]);
+		static constexpr Group table[] = {UnpackGroup <BITS + 1, T>...};
+		return table;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Unpack the values                                                     //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void Unpack (
+		T target[],				// Unpacked values
+		const uint64_t source[],	// Packed words
+		size_t size,			// Count of values
+		size_t bits				// Width of a value in bits
+	){
+		// Whole groups of 64 values occupy exactly "bits" words
+		const auto group = GroupTable <T> (make_index_sequence <64> ())[bits - 1];
+		const size_t groups = size / 64;
+		for (size_t i = 0; i < groups; i++)
+			group (target + i * 64, source + i * bits);
+
+		// The rest of the values
+		const uint64_t mask = Mask (bits);
+		size_t pos = groups * 64 * bits;
+		for (size_t i = groups * 64; i < size; i++, pos += bits) {
+			const size_t index = pos / 64;
+			const size_t shift = pos % 64;
+			uint64_t value = source[index] >> shift;
+			if (shift + bits > 64)
+				value |= source[index + 1] << (64 - shift);
+			target[i] = static_cast <T> (value & mask);
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Random access to a packed value                                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static uint64_t Get (
+		const uint64_t source[],	// Packed words
+		size_t index,			// Index of the value
+		size_t bits				// Width of a value in bits
+	){
+		const size_t pos = index * bits;
+		const size_t shift = pos % 64;
+		uint64_t value = source[pos / 64] >> shift;
+		if (shift + bits > 64)
+			value |= source[pos / 64 + 1] << (64 - shift);
+		return value & Mask (bits);
+	}
+};
+
+//****************************************************************************//
+//      Bit-packed integer array                                              //
+//****************************************************************************//
+
+// Stores an integer array in the minimal count of bits per value. The plain
+// encoding packs the values as they are. The frame of reference encoding packs
+// the offsets from the minimum value, so a narrow range of large or negative
+// values is packed tightly. The delta encoding packs the differences of the
+// adjacent values of an array sorted in ascending order. It gives the best
+// compression of sorted keys, but has no random access.
+template <typename T>
+class BitPackedArray
+{
+	static_assert (is_integral_v <T>, "BitPackedArray: integer types only");
+
+//============================================================================//
+//      Constants                                                             //
+//============================================================================//
+public:
+	enum Encoding {
+		PLAIN,				// Values as they are
+		FOR,				// Offsets from the minimum value
+		DELTA				// Differences of the adjacent sorted values
+	};
+
+//============================================================================//
+//      Members                                                               //
+//============================================================================//
+private:
+	vector <uint64_t>	words;		// Packed values
+	size_t				size;		// Count of values
+	size_t				bits;		// Width of a packed value in bits
+	T					base;		// Minimum value (FOR) or the first value (DELTA)
+	Encoding			encoding;	// Encoding of the values
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Constructor                                                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	BitPackedArray (
+		const T array[],		// Values to pack
+		size_t size,			// Count of values
+		Encoding encoding = PLAIN	// Encoding of the values
+	) :	size (size),
+		bits (0),
+		base (0),
+		encoding (encoding)
+	{
+		vector <T> temp;
+		const T *source = array;
+		if (size && encoding == FOR) {
+
+			// Offsets from the minimum value
+			T max;
+			Array::MinMax (array, size, base, max);
+			temp.assign (array, array + size);
+			Array::SubScalar (temp.data(), size, base);
+			source = temp.data();
+		}
+		else if (size && encoding == DELTA) {
+
+			// Differences of the adjacent values
+			base = array[0];
+			temp.assign (array, array + size);
+			Array::SubVector (temp.data() + 1, array, size - 1);
+			temp[0] = 0;
+			source = temp.data();
+		}
+		bits = BitPacking::Width (source, size);
+		words.resize (BitPacking::Words (size, bits));
+		BitPacking::Pack (words.data(), source, size, bits);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Unpack all the values                                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void Unpack (T target[]) const {
+		BitPacking::Unpack (target, words.data(), size, bits);
+		if (encoding == FOR)
+			Array::AddScalar (target, size, base);
+		else if (encoding == DELTA) {
+
+			// Prefix sums of the differences
+			T sum = base;
+			for (size_t i = 0; i < size; i++)
+				target[i] = sum += target[i];
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Random access to a value                                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	T Get (size_t index) const {
+		const T value = static_cast <T> (BitPacking::Get (words.data(), index, bits));
+		switch (encoding) {
+			case PLAIN:
+				return value;
+			case FOR:
+				return static_cast <T> (value + base);
+			default:
+				throw runtime_error ("BitPackedArray: no random access to the delta encoded values");
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Array properties                                                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Size (void) const {
+		return size;
+	}
+	size_t Bits (void) const {
+		return bits;
+	}
+	size_t Memory (void) const {
+		return words.size() * sizeof (uint64_t);
+	}
+	const uint64_t* Data (void) const {
+		return words.data();
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,237 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                   BOOLEAN QUERY ENGINE OVER BITMAP INDEXES                   #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<Array.h>
+# include	<BitField.h>
+# include	<vector>
+# include	<algorithm>
+
+using namespace std;
+
+//****************************************************************************//
+//      Boolean query engine over bitmap indexes                              //
+//****************************************************************************//
+
+// An expression tree of AND, OR, XOR and NOT operators over dense bitmaps of
+// 64-bit words. The tree is evaluated block by block, so all the intermediate
+// results of a block stay in the L1 cache instead of streaming a temporary
+// bitmap through the memory for each operator. The right operand of AND (OR)
+// is not evaluated for a block where the left operand has no set (reset) bits,
+// so the most selective predicate should be the left one.
+class BitmapQuery
+{
+//============================================================================//
+//      Constants                                                             //
+//============================================================================//
+public:
+	static constexpr size_t BLOCK_WORDS = 512;		// 64-bit words in a block (4 KB)
+	static constexpr size_t NOT_FOUND = static_cast <size_t> (-1);
+
+	// Node types
+	enum Op {
+		LEAF,				// Source bitmap
+		AND,				// Bitwise AND of two nodes
+		OR,					// Bitwise OR of two nodes
+		XOR,				// Bitwise XOR of two nodes
+		NOT					// Bitwise NOT of a node
+	};
+
+//============================================================================//
+//      Members                                                               //
+//============================================================================//
+private:
+	struct Node
+	{
+		Op				op;			// Node type
+		size_t			left;		// Index of the left operand
+		size_t			right;		// Index of the right operand
+		const uint64_t	*data;		// Source bitmap of a leaf
+	};
+	vector <Node>	nodes;			// Nodes of the expression trees
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Add a new node to the tree                                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Add (Op op, size_t left, size_t right, const uint64_t *data) {
+		nodes.push_back ({op, left, right, data});
+		return nodes.size() - 1;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count of scratch blocks needed to evaluate the node                   //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Depth (size_t index) const {
+		const Node &node = nodes[index];
+		switch (node.op) {
+			case LEAF:
+				return 0;
+			case NOT:
+				return Depth (node.left);
+			default: {
+				const size_t right = nodes[node.right].op == LEAF ? 0 : Depth (node.right) + 1;
+				return max (Depth (node.left), right);
+			}
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Evaluate a single block of the node                                   //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void Block (
+		size_t index,				// Index of the node
+		size_t offset,				// Offset of the block in words
+		size_t words,				// Block size in words
+		uint64_t target[],			// Target block
+		uint64_t scratch[]			// Scratch space for the operands
+	) const {
+		const Node &node = nodes[index];
+		if (node.op == LEAF) {
+			Array::Copy (target, node.data + offset, words);
+			return;
+		}
+
+		// Evaluate the left operand into the target block
+		Block (node.left, offset, words, target, scratch);
+		if (node.op == NOT) {
+			Array::Not (target, words);
+			return;
+		}
+
+		// Skip the right operand if the result does not depend on it
+		const size_t bits = words * 64;
+		if (node.op == AND && BitField::FindSetBitFwd (target, 0, bits) == NOT_FOUND)
+			return;
+		if (node.op == OR && BitField::FindResetBitFwd (target, 0, bits) == NOT_FOUND)
+			return;
+
+		// Leaf operands are used in place
+		const uint64_t *source;
+		const Node &right = nodes[node.right];
+		if (right.op == LEAF)
+			source = right.data + offset;
+		else {
+			Block (node.right, offset, words, scratch, scratch + BLOCK_WORDS);
+			source = scratch;
+		}
+
+		// Combine the operands
+		switch (node.op) {
+			case AND:
+				Array::AndVector (target, source, words);
+				break;
+			case OR:
+				Array::OrVector (target, source, words);
+				break;
+			default:
+				Array::XorVector (target, source, words);
+				break;
+		}
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Expression nodes                                                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Leaf (const uint64_t bitmap[]) {
+		return Add (LEAF, 0, 0, bitmap);
+	}
+	size_t And (size_t left, size_t right) {
+		return Add (AND, left, right, nullptr);
+	}
+	size_t Or (size_t left, size_t right) {
+		return Add (OR, left, right, nullptr);
+	}
+	size_t Xor (size_t left, size_t right) {
+		return Add (XOR, left, right, nullptr);
+	}
+	size_t Not (size_t node) {
+		return Add (NOT, node, 0, nullptr);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Evaluate the expression into the result bitmap                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+// Returns the count of set bits in the result bitmap. The bits past the size
+// of the bitmaps are cleared in the last word of the result.
+	size_t Evaluate (
+		size_t root,				// Root node of the expression
+		uint64_t result[],			// Result bitmap
+		size_t size					// Size of the bitmaps in bits
+	) const {
+		const size_t words = (size + 63) / 64;
+		vector <uint64_t> scratch ((Depth (root) + 1) * BLOCK_WORDS);
+		size_t count = 0;
+		for (size_t offset = 0; offset < words; offset += BLOCK_WORDS) {
+			const size_t block = min (BLOCK_WORDS, words - offset);
+			const size_t bits = min (block * 64, size - offset * 64);
+			uint64_t *target = result + offset;
+			Block (root, offset, block, target, scratch.data());
+			BitField::ResetBits (target, bits, block * 64);
+			count += BitField::CountBits (target, 0, bits);
+		}
+		return count;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count matching bits without materializing the result                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Count (
+		size_t root,				// Root node of the expression
+		size_t size					// Size of the bitmaps in bits
+	) const {
+		const size_t words = (size + 63) / 64;
+		vector <uint64_t> scratch ((Depth (root) + 2) * BLOCK_WORDS);
+		uint64_t *target = scratch.data() + (Depth (root) + 1) * BLOCK_WORDS;
+		size_t count = 0;
+		for (size_t offset = 0; offset < words; offset += BLOCK_WORDS) {
+			const size_t block = min (BLOCK_WORDS, words - offset);
+			const size_t bits = min (block * 64, size - offset * 64);
+			Block (root, offset, block, target, scratch.data());
+			count += BitField::CountBits (target, 0, bits);
+		}
+		return count;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Search for the first matching bit                                     //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t FindFirst (
+		size_t root,				// Root node of the expression
+		size_t size					// Size of the bitmaps in bits
+	) const {
+		const size_t words = (size + 63) / 64;
+		vector <uint64_t> scratch ((Depth (root) + 2) * BLOCK_WORDS);
+		uint64_t *target = scratch.data() + (Depth (root) + 1) * BLOCK_WORDS;
+		for (size_t offset = 0; offset < words; offset += BLOCK_WORDS) {
+			const size_t block = min (BLOCK_WORDS, words - offset);
+			const size_t bits = min (block * 64, size - offset * 64);
+			Block (root, offset, block, target, scratch.data());
+			const size_t pos = BitField::FindSetBitFwd (target, 0, bits);
+			if (pos != NOT_FOUND)
+				return offset * 64 + pos;
+		}
+		return NOT_FOUND;
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
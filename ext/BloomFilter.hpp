@@ -0,0 +1,233 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                     BLOOM FILTER ON TOP OF THE BIT FIELD                     #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<Array.h>
+# include	<BitField.h>
+# include	<vector>
+# include	<cmath>
+# include	<stdexcept>
+
+using namespace std;
+
+//****************************************************************************//
+//      Bloom filter on top of the bit field                                  //
+//****************************************************************************//
+
+// Approximate membership filter over a dense bit field. Each key is hashed
+// once with Array::Hash64, and its k bit positions are derived from the hash
+// value by a remix with a different constant per position (plain double
+// hashing is visibly biased within a 512-bit block). A blocked filter keeps all the
+// k bits of a key within one 512-bit cache line, so a query touches a single
+// line of memory at the cost of a slightly higher false positive rate. Batched
+// operations hash a group of keys first and prefetch their lines before
+// touching the bits, so the cache misses of the group overlap (only the line
+// of the first bit is prefetched for the classic filter).
+class BloomFilter
+{
+//============================================================================//
+//      Constants                                                             //
+//============================================================================//
+public:
+	static constexpr size_t BLOCK_BITS = 512;		// Bits in a cache line
+	static constexpr size_t BATCH_SIZE = 16;		// Keys hashed ahead of probing
+
+//============================================================================//
+//      Members                                                               //
+//============================================================================//
+private:
+	vector <uint64_t>	bits;		// Bit field
+	size_t				size;		// Size of the bit field in bits
+	size_t				blocks;		// Count of cache line blocks
+	size_t				hashes;		// Count of bits per key
+	bool				blocked;	// Cache line local bits
+	bool				prefetch;	// Prefetch the lines of batched keys
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Start position and range of bits the key maps to                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void Range (uint64_t hash, size_t &base, size_t &range) const {
+		if (blocked) {
+
+			// Remix the hash to select the block independently of the bits
+			const uint64_t mix = (hash ^ (hash >> 31)) * 0x9E3779B97F4A7C15ULL;
+			base = static_cast <size_t> ((static_cast <unsigned __int128> (mix) * blocks) >> 64) * BLOCK_BITS;
+			range = BLOCK_BITS;
+		}
+		else {
+			base = 0;
+			range = size;
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Bit position of the given hash function                               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static size_t Position (uint64_t hash, size_t index, size_t range) {
+		uint64_t x = (hash ^ index * 0x9E3779B97F4A7C15ULL) * 0xBF58476D1CE4E5B9ULL;
+		x = (x ^ x >> 31) * 0x94D049BB133111EBULL;
+		return static_cast <size_t> ((static_cast <unsigned __int128> (x) * range) >> 64);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Set the bits of a hashed key                                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void Set (uint64_t hash) {
+		size_t base, range;
+		Range (hash, base, range);
+		for (size_t i = 0; i < hashes; i++)
+			BitField::SetBit (bits.data(), base + Position (hash, i, range));
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Check the bits of a hashed key                                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool Get (uint64_t hash) const {
+		size_t base, range;
+		Range (hash, base, range);
+		for (size_t i = 0; i < hashes; i++)
+			if (!BitField::GetBit (bits.data(), base + Position (hash, i, range)))
+				return false;
+		return true;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Hash a group of keys and prefetch their cache lines                   //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	void Hash (uint64_t hash[], const T keys[], size_t count) const {
+		for (size_t i = 0; i < count; i++)
+			hash[i] = Array::Hash64 (&keys[i], 1);
+		if (prefetch) {
+			for (size_t i = 0; i < count; i++) {
+				size_t base, range;
+				Range (hash[i], base, range);
+				__builtin_prefetch (bits.data() + (base + Position (hash[i], 0, range)) / 64);
+			}
+		}
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Constructor                                                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	BloomFilter (
+		size_t size,			// Size of the filter in bits
+		size_t hashes,			// Count of bits per key
+		bool blocked = true,	// Cache line local bits
+		bool prefetch = true	// Prefetch the lines of batched keys
+	) :	bits ((size + BLOCK_BITS - 1) / BLOCK_BITS * (BLOCK_BITS / 64)),
+		size (bits.size() * 64),
+		blocks (bits.size() / (BLOCK_BITS / 64)),
+		hashes (hashes),
+		blocked (blocked),
+		prefetch (prefetch)
+	{
+		if (!size || !hashes)
+			throw runtime_error ("BloomFilter: size and count of hashes should be positive");
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Single key operations                                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	void Insert (T key) {
+		Set (Array::Hash64 (&key, 1));
+	}
+	template <typename T>
+	bool Contains (T key) const {
+		return Get (Array::Hash64 (&key, 1));
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Batched insertion                                                     //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	void Insert (const T keys[], size_t count) {
+		uint64_t hash [BATCH_SIZE];
+		for (size_t i = 0; i < count; i += BATCH_SIZE) {
+			const size_t batch = min (BATCH_SIZE, count - i);
+			Hash (hash, keys + i, batch);
+			for (size_t j = 0; j < batch; j++)
+				Set (hash[j]);
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Batched query                                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+// Returns the count of keys which may be in the set
+	template <typename T>
+	size_t Query (
+		bool result[],			// Membership flags of the keys
+		const T keys[],			// Keys to check
+		size_t count			// Count of keys
+	) const {
+		uint64_t hash [BATCH_SIZE];
+		size_t found = 0;
+		for (size_t i = 0; i < count; i += BATCH_SIZE) {
+			const size_t batch = min (BATCH_SIZE, count - i);
+			Hash (hash, keys + i, batch);
+			for (size_t j = 0; j < batch; j++) {
+				result[i + j] = Get (hash[j]);
+				found += result[i + j];
+			}
+		}
+		return found;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Filter properties                                                     //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Size (void) const {
+		return size;
+	}
+	size_t Hashes (void) const {
+		return hashes;
+	}
+	size_t CountBits (void) const {
+		return BitField::CountBits (bits.data(), 0, size);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Theoretical false positive rate after inserting the count of keys     //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+// The classic filter follows (1 - e^(-kn/m))^k. The load of the blocks of a
+// blocked filter is Poisson distributed, so the rate is averaged over it.
+	double FalsePositiveRate (size_t count) const {
+		const double k = hashes;
+		if (!blocked)
+			return pow (1.0 - exp (-k * count / size), k);
+		const double lambda = static_cast <double> (count) / blocks;
+		const size_t limit = static_cast <size_t> (lambda + 10.0 * sqrt (lambda) + 10.0);
+		double weight = exp (-lambda);
+		double rate = 0.0;
+		for (size_t j = 0; j <= limit; j++) {
+			rate += weight * pow (1.0 - pow (1.0 - 1.0 / BLOCK_BITS, k * j), k);
+			weight *= lambda / (j + 1);
+		}
+		return rate;
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,188 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                     SORT WITH A BOUNDED TEMPORARY BUFFER                     #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<algorithm>
+# include	<functional>
+# include	<Array.h>
+
+using namespace std;
+
+//****************************************************************************//
+//      Sort with a bounded temporary buffer                                  //
+//****************************************************************************//
+
+// Sorts an array with a temporary array of any size, for example 5% of the
+// array, instead of the full size buffer of the Array:: sorts. The array is cut
+// into blocks of the temporary array size, each block is sorted with the Array::
+// radix sort, and then the blocks are merged bottom-up. A merge of two runs
+// copies the shorter run to the temporary array if it fits there. Otherwise
+// the runs are split at the middle of the longer one, the inner halves are
+// swapped with a rotation and both parts are merged recursively, until the
+// pieces fit the temporary array. Temporary arrays shorter than MIN_BLOCK
+// elements are not worth a radix sort, so the blocks are sorted by insertion,
+// and the merges work even with no temporary array at all. The sort is stable.
+class BoundedSort
+{
+//============================================================================//
+//      Constants                                                             //
+//============================================================================//
+public:
+	static constexpr size_t MIN_BLOCK = 64;		// Min block size sorted by the radix sort
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Sort a short block by insertion                                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T, typename C>
+	static void Insert (
+		T array[],				// Block to sort
+		size_t size,			// Count of elements
+		C comp					// Order of the sort
+	){
+		for (size_t i = 1; i < size; i++) {
+			const T value = array[i];
+			size_t j = i;
+			for (; j > 0 && comp (value, array[j - 1]); j--)
+				array[j] = array[j - 1];
+			array[j] = value;
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Merge two adjacent sorted runs in place                               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T, typename C>
+	static void Merge (
+		T array[],				// Left run followed by the right run
+		size_t left,			// Count of elements in the left run
+		size_t right,			// Count of elements in the right run
+		T temp[],				// Temporary array
+		size_t tsize,			// Count of elements in the temporary array
+		C comp					// Order of the runs
+	){
+		while (left && right) {
+
+			// Runs are already in order
+			if (!comp (array[left], array[left - 1]))
+				return;
+
+			// Left run fits the temporary array. Merge forward
+			if (left <= tsize) {
+				Array::Copy (temp, array, left);
+				size_t i = 0, j = left, k = 0;
+				while (i < left && j < left + right)
+					array[k++] = comp (array[j], temp[i]) ? array[j++] : temp[i++];
+				while (i < left)
+					array[k++] = temp[i++];
+				return;
+			}
+
+			// Right run fits the temporary array. Merge backward
+			if (right <= tsize) {
+				Array::Copy (temp, array + left, right);
+				size_t i = left, j = right, k = left + right;
+				while (i > 0 && j > 0)
+					array[--k] = comp (temp[j - 1], array[i - 1]) ? array[--i] : temp[--j];
+				while (j > 0)
+					array[--k] = temp[--j];
+				return;
+			}
+
+			// Single elements in the wrong order
+			if (left + right == 2) {
+				swap (array[0], array[1]);
+				return;
+			}
+
+			// Split the longer run at the middle and the other one at the
+			// matching position, then swap the inner parts
+			size_t lcut, rcut;
+			if (left > right) {
+				lcut = left / 2;
+				rcut = lower_bound (array + left, array + left + right, array[lcut], comp) - (array + left);
+			}
+			else {
+				rcut = right / 2;
+				lcut = upper_bound (array, array + left, array[left + rcut], comp) - array;
+			}
+			rotate (array + lcut, array + left, array + left + rcut);
+
+			// Merge the first part recursively and the second one in the loop
+			Merge (array, lcut, rcut, temp, tsize, comp);
+			array += lcut + rcut;
+			left -= lcut;
+			right -= rcut;
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Sort the blocks and merge them                                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T, typename S, typename C>
+	static void Sort (
+		T array[],				// Array to sort
+		T temp[],				// Temporary array
+		size_t tsize,			// Count of elements in the temporary array
+		size_t size,			// Count of elements
+		S sort,					// Block sort function
+		C comp					// Order of the sort
+	){
+		// Sort the blocks
+		const size_t block = max (tsize, MIN_BLOCK);
+		for (size_t offset = 0; offset < size; offset += block) {
+			const size_t count = min (block, size - offset);
+			if (tsize >= MIN_BLOCK)
+				sort (array + offset, temp, count);
+			else
+				Insert (array + offset, count, comp);
+		}
+
+		// Merge the runs bottom-up
+		for (size_t width = block; width < size; width *= 2) {
+			for (size_t offset = 0; offset + width < size; offset += 2 * width)
+				Merge (array + offset, width, min (width, size - offset - width), temp, tsize, comp);
+		}
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Ascending sort order                                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void SortAsc (T array[], T temp[], size_t tsize, size_t size) {
+		Sort (array, temp, tsize, size, [](T array[], T temp[], size_t size){
+			Array::RadixSortAsc (array, temp, size);
+		}, less <T> ());
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Descending sort order                                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void SortDsc (T array[], T temp[], size_t tsize, size_t size) {
+		Sort (array, temp, tsize, size, [](T array[], T temp[], size_t size){
+			Array::RadixSortDsc (array, temp, size);
+		}, greater <T> ());
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,186 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                        DICTIONARY ENCODING OF COLUMNS                        #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<vector>
+# include	<bit>
+# include	<limits>
+# include	<stdexcept>
+# include	<type_traits>
+# include	<Array.h>
+# include	"Gallop.hpp"
+# include	"HashTable.hpp"
+# include	"Permutation.hpp"
+
+using namespace std;
+
+//****************************************************************************//
+//      Dictionary encoding of columns                                        //
+//****************************************************************************//
+
+// Replaces each value of a column by a 32-bit code, which is the index of the
+// value in a dictionary of the distinct values. The sorted encoder builds the
+// dictionary by Array::RadixSortAsc and Array::Unique, so the codes keep the
+// order of the values and range predicates can run on the codes. The codes are
+// searched in one batch: the rows are visited in the sort order of the values,
+// so each search gallops forward from the previous code, and a run of equal
+// values is searched once. The hash encoder reads the column once and numbers
+// the values in the order of their first occurrence in a HashTable, which is
+// faster, but the codes are not ordered. The Array:: searches work with
+// integers only, so floating-point values are encoded by their bits, mapped to
+// unsigned integers of the same order: the decoded column has exactly the bits
+// of the original one, and 0.0 and -0.0 have different codes. Decoding is a
+// gather from the dictionary. The dictionary must have room for as many values
+// as the column, and the encoders throw runtime_error if the column has more
+// than 2^32 distinct values.
+class Dictionary
+{
+//============================================================================//
+//      Types                                                                 //
+//============================================================================//
+private:
+
+	// Integer type, which the values are searched as
+	template <typename T>
+	using Key = conditional_t <is_floating_point_v <T>,
+		conditional_t <sizeof (T) == 4, uint32_t, uint64_t>, T>;
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Integer key of the value                                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Flips the sign bit of positive values and all the bits of negative ones
+	template <typename T>
+	static Key <T> ToKey (T value) {
+		typedef Key <T> K;
+		if constexpr (is_floating_point_v <T>) {
+			const K bits = bit_cast <K> (value);
+			const K sign = K (1) << (8 * sizeof (K) - 1);
+			return bits & sign ? ~bits : bits | sign;
+		}
+		else
+			return value;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Value of the integer key                                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static T FromKey (Key <T> key) {
+		typedef Key <T> K;
+		if constexpr (is_floating_point_v <T>) {
+			const K sign = K (1) << (8 * sizeof (K) - 1);
+			return bit_cast <T> (key & sign ? key & ~sign : ~key);
+		}
+		else
+			return key;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Code of the dictionary index                                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// The codes are 32-bit, so a dictionary has at most 2^32 values
+	static uint32_t Code (size_t index) {
+		if (index > numeric_limits <uint32_t>::max())
+			throw runtime_error ("Dictionary: More than 2^32 distinct values to encode");
+		return static_cast <uint32_t> (index);
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Sorted dictionary encoding                                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Returns the count of values in the dictionary
+	template <typename T>
+	static size_t EncodeSorted (
+		T dictionary[],			// Target array of the distinct values
+		uint32_t code[],		// Target array of the codes
+		const T array[],		// Column to encode
+		size_t size				// Count of values in the column
+	){
+		typedef Key <T> K;
+
+		// Sort the keys of the values and remove the duplicates
+		vector <K> keys (size), temp (size);
+		for (size_t i = 0; i < size; i++)
+			keys[i] = ToKey (array[i]);
+		Array::RadixSortAsc (keys.data(), temp.data(), size);
+		const size_t count = Array::Unique (temp.data(), keys.data(), size);
+		if (count) Code (count - 1);
+
+		// Search the codes of the rows in the sort order of their values
+		for (size_t i = 0; i < size; i++)
+			keys[i] = ToKey (array[i]);
+		vector <size_t> order (size);
+		Permutation::ArgsortAsc (order.data(), keys.data(), size);
+		size_t index = 0;
+		for (size_t k = 0; k < size; k++) {
+			const size_t i = order[k];
+			if (k == 0 || keys[i] != keys[order[k - 1]])
+				index = Gallop::LowerAsc (temp.data(), count, index, keys[i]);
+			code[i] = static_cast <uint32_t> (index);
+		}
+		for (size_t i = 0; i < count; i++)
+			dictionary[i] = FromKey <T> (temp[i]);
+		return count;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Hash dictionary encoding                                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Returns the count of values in the dictionary
+	template <typename T>
+	static size_t EncodeHash (
+		T dictionary[],			// Target array of the distinct values
+		uint32_t code[],		// Target array of the codes
+		const T array[],		// Column to encode
+		size_t size				// Count of values in the column
+	){
+		typedef Key <T> K;
+
+		// Number the values in the order of their first occurrence
+		HashTable <K> table;
+		size_t count = 0;
+		for (size_t i = 0; i < size; i++) {
+			const size_t index = table.Insert (ToKey (array[i]));
+			if (index == count)
+				dictionary[count++] = array[i];
+			code[i] = Code (index);
+		}
+		return count;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Decoding                                                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void Decode (
+		T array[],				// Target column
+		const uint32_t code[],	// Codes of the values
+		size_t size,			// Count of values in the column
+		const T dictionary[]	// Distinct values
+	){
+		for (size_t i = 0; i < size; i++)
+			array[i] = dictionary[code[i]];
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
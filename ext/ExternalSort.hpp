@@ -0,0 +1,377 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                            EXTERNAL SORT OF FILES                            #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<string>
+# include	<vector>
+# include	<memory>
+# include	<cerrno>
+# include	<cstring>
+# include	<cstdlib>
+# include	<stdexcept>
+# include	<algorithm>
+# include	<functional>
+# include	<fcntl.h>
+# include	<unistd.h>
+# include	<sys/stat.h>
+# include	<Array.h>
+
+using namespace std;
+
+//****************************************************************************//
+//      External sort of files                                                //
+//****************************************************************************//
+
+// Sorts a file of fixed-size records that may not fit in memory. The input is
+// read in runs of run_size bytes, each run is sorted in memory with the Array::
+// radix sort and spilled to a temporary file next to the output. Then all the
+// runs are merged at once with a heap of run heads. Each run is read through a
+// buffer of buffer_size bytes, so the merge does large sequential reads, and
+// the output is written through a buffer of the same size. The run sort of
+// plain keys uses about 2 * run_size of memory. The key sorts copy the keys and
+// the record pointers of a run to arrays of their own, and use up to
+// 3 * run_size for 16-byte records. The merge uses (runs + 1) * buffer_size.
+// With the direct flag the files are opened with O_DIRECT to bypass the page
+// cache, and the unaligned tails are written with the flag cleared. The key
+// sorts take records of a key and a 64-bit value and sort them by the keys.
+class ExternalSort
+{
+//============================================================================//
+//      Constants                                                             //
+//============================================================================//
+public:
+	static constexpr size_t ALIGN = 4096;				// Alignment of the direct I/O in bytes
+	static constexpr size_t RUN_SIZE = 64 << 20;		// Default run size in bytes
+	static constexpr size_t MERGE_SIZE = 1 << 20;		// Default merge buffer size in bytes
+
+//============================================================================//
+//      Types                                                                 //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Record of the key sorts                                               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	struct Pair
+	{
+		T			key;		// Sort key
+		uint64_t	value;		// Value linked to the key
+	};
+
+//============================================================================//
+//      Private types                                                         //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Memory block aligned for the direct I/O                               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	class Buffer
+	{
+		unique_ptr <T, decltype (&free)>	data;	// Block of memory
+
+	public:
+		Buffer (size_t bytes) :
+			data (static_cast <T*> (aligned_alloc (ALIGN, (bytes + ALIGN - 1) / ALIGN * ALIGN)), &free)
+		{
+			if (!data)
+				throw runtime_error ("ExternalSort: Can not allocate " + to_string (bytes) + " bytes");
+		}
+		T* Data (void) const {
+			return data.get();
+		}
+	};
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      File with positional reads and writes                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	class File
+	{
+		int		fd;			// File descriptor
+		bool	direct;		// The file is opened with O_DIRECT
+		string	path;		// Path to the file
+
+		[[noreturn]] void Fail (const string &action) const {
+			throw runtime_error ("ExternalSort: Can not " + action + " '" + path + "': " + strerror (errno));
+		}
+
+	public:
+		File (const string &path, int flags, bool direct) : fd (-1), direct (false), path (path) {
+# ifdef	O_DIRECT
+			if (direct) {
+				fd = open (path.c_str(), flags | O_DIRECT, 0644);
+				this->direct = fd >= 0;
+			}
+# endif
+			// File systems with no direct I/O support fall back to the page cache
+			if (fd < 0)
+				fd = open (path.c_str(), flags, 0644);
+			if (fd < 0)
+				Fail ("open");
+		}
+		~File (void) {
+			close (fd);
+		}
+
+		// Size of the file in bytes
+		size_t Size (void) const {
+			struct stat info;
+			if (fstat (fd, &info))
+				Fail ("stat");
+			return info.st_size;
+		}
+
+		// Read up to the count of bytes. The result is short at the end of file
+		size_t Read (void *buffer, size_t bytes, size_t offset) const {
+			if (direct)
+				bytes = (bytes + ALIGN - 1) / ALIGN * ALIGN;
+			size_t done = 0;
+			while (done < bytes) {
+				ssize_t count = pread (fd, static_cast <char*> (buffer) + done, bytes - done, offset + done);
+				if (count < 0 && errno == EINTR)
+					continue;
+				if (count < 0)
+					Fail ("read");
+				if (count == 0)
+					break;
+				done += count;
+			}
+			return done;
+		}
+
+		// Write the count of bytes. The direct I/O needs aligned sizes, so the
+		// unaligned tail of a file is written through the page cache
+		void Write (const void *buffer, size_t bytes, size_t offset) {
+# ifdef	O_DIRECT
+			if (direct && bytes % ALIGN) {
+				fcntl (fd, F_SETFL, fcntl (fd, F_GETFL) & ~O_DIRECT);
+				direct = false;
+			}
+# endif
+			size_t done = 0;
+			while (done < bytes) {
+				ssize_t count = pwrite (fd, static_cast <const char*> (buffer) + done, bytes - done, offset + done);
+				if (count < 0 && errno == EINTR)
+					continue;
+				if (count < 0)
+					Fail ("write");
+				done += count;
+			}
+		}
+	};
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Path of a temporary file removed on every exit                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	class Spill
+	{
+		string	path;		// Path to the file
+
+	public:
+		Spill (const string &path) : path (path) {}
+		~Spill (void) {
+			unlink (path.c_str());
+		}
+		Spill (const Spill&) = delete;
+		Spill& operator = (const Spill&) = delete;
+
+		// Path to the file
+		const string& Path (void) const {
+			return path;
+		}
+	};
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Sort the runs and merge them                                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename R, typename S, typename C>
+	static size_t Sort (
+		const string &input,	// Path to the input file
+		const string &output,	// Path to the output file
+		size_t run_size,		// Run size in bytes
+		size_t buffer_size,		// Merge buffer size in bytes
+		bool direct,			// Use the direct I/O
+		S sort,					// Run sort function
+		C comp					// Order of the records
+	){
+		// Sizes in whole aligned blocks of records
+		run_size = max (run_size / ALIGN, size_t (1)) * ALIGN;
+		buffer_size = max (buffer_size / ALIGN, size_t (1)) * ALIGN;
+		const size_t buffer_count = buffer_size / sizeof (R);
+
+		// Read, sort and spill the runs. The spill file is removed on every exit,
+		// also when an error is thrown
+		const Spill spill (output + ".runs");
+		vector <size_t> bounds (1, 0);
+		{
+			File source (input, O_RDONLY, direct);
+			File target (spill.Path(), O_WRONLY | O_CREAT | O_TRUNC, direct);
+			const size_t size = source.Size();
+			if (size % sizeof (R))
+				throw runtime_error ("ExternalSort: Size of '" + input + "' is not a multiple of the record size");
+			Buffer <R> run (run_size);
+			for (size_t offset = 0; offset < size; offset += run_size) {
+				const size_t bytes = min (run_size, size - offset);
+				if (source.Read (run.Data(), bytes, offset) < bytes)
+					throw runtime_error ("ExternalSort: File '" + input + "' was truncated while reading");
+				sort (run.Data(), bytes / sizeof (R));
+				target.Write (run.Data(), bytes, offset);
+				bounds.push_back (offset + bytes);
+			}
+		}
+		const size_t runs = bounds.size() - 1;
+
+		// Merge the runs
+		{
+			File source (spill.Path(), O_RDONLY, direct);
+			File target (output, O_WRONLY | O_CREAT | O_TRUNC, direct);
+			vector <Buffer <R>> buffers;
+			vector <size_t> offsets (bounds.begin(), bounds.end() - 1);
+			vector <size_t> heads (runs, 0);
+			vector <size_t> counts (runs, 0);
+
+			// Refill the buffer of a run. Returns false when the run is over
+			auto refill = [&](size_t r){
+				const size_t bytes = min (buffer_size, bounds[r + 1] - offsets[r]);
+				if (bytes == 0)
+					return false;
+				source.Read (buffers[r].Data(), bytes, offsets[r]);
+				offsets[r] += bytes;
+				heads[r] = 0;
+				counts[r] = bytes / sizeof (R);
+				return true;
+			};
+
+			// Heap of the runs ordered by their head records. Equal records
+			// are taken from the earlier runs first, so the sort is stable
+			auto later = [&](size_t a, size_t b){
+				const R &x = buffers[a].Data()[heads[a]];
+				const R &y = buffers[b].Data()[heads[b]];
+				if (comp (y, x))
+					return true;
+				if (comp (x, y))
+					return false;
+				return a > b;
+			};
+			vector <size_t> heap;
+			for (size_t r = 0; r < runs; r++) {
+				buffers.emplace_back (buffer_size);
+				if (refill (r))
+					heap.push_back (r);
+			}
+			make_heap (heap.begin(), heap.end(), later);
+
+			// Move the least head record to the output until all the runs
+			// are over. The output buffer is written when it is full
+			Buffer <R> merged (buffer_size);
+			size_t count = 0;
+			size_t written = 0;
+			while (!heap.empty()) {
+				pop_heap (heap.begin(), heap.end(), later);
+				const size_t r = heap.back();
+				merged.Data()[count++] = buffers[r].Data()[heads[r]++];
+				if (count == buffer_count) {
+					target.Write (merged.Data(), buffer_size, written);
+					written += buffer_size;
+					count = 0;
+				}
+				if (heads[r] < counts[r] || refill (r))
+					push_heap (heap.begin(), heap.end(), later);
+				else
+					heap.pop_back ();
+			}
+			if (count)
+				target.Write (merged.Data(), count * sizeof (R), written);
+		}
+		return runs;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Sort the keys of the pair records and keep the values with them       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void SortPairs (
+		Pair <T> pairs[],		// Records to sort
+		size_t size,			// Count of records
+		void (*func)(T key[], const void* ptr[], T tkey[], const void* tptr[], size_t size)
+	){
+		vector <T> key (size), tkey (size);
+		vector <const void*> ptr (size), tptr (size);
+		for (size_t i = 0; i < size; i++) {
+			key[i] = pairs[i].key;
+			ptr[i] = reinterpret_cast <const void*> (pairs[i].value);
+		}
+		func (key.data(), ptr.data(), tkey.data(), tptr.data(), size);
+		for (size_t i = 0; i < size; i++) {
+			pairs[i].key = key[i];
+			pairs[i].value = reinterpret_cast <uint64_t> (ptr[i]);
+		}
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Ascending sort order                                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Returns the count of the spilled runs
+	template <typename T>
+	static size_t SortAsc (const string &input, const string &output, size_t run_size = RUN_SIZE, size_t buffer_size = MERGE_SIZE, bool direct = false) {
+		Buffer <T> temp (run_size);
+		return Sort <T> (input, output, run_size, buffer_size, direct, [&](T array[], size_t size){
+			Array::RadixSortAsc (array, temp.Data(), size);
+		}, less <T> ());
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Descending sort order                                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static size_t SortDsc (const string &input, const string &output, size_t run_size = RUN_SIZE, size_t buffer_size = MERGE_SIZE, bool direct = false) {
+		Buffer <T> temp (run_size);
+		return Sort <T> (input, output, run_size, buffer_size, direct, [&](T array[], size_t size){
+			Array::RadixSortDsc (array, temp.Data(), size);
+		}, greater <T> ());
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Ascending sort order of key and value records                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static size_t SortKeyAsc (const string &input, const string &output, size_t run_size = RUN_SIZE, size_t buffer_size = MERGE_SIZE, bool direct = false) {
+		return Sort <Pair <T>> (input, output, run_size, buffer_size, direct, [](Pair <T> pairs[], size_t size){
+			SortPairs (pairs, size, Array::RadixSortKeyAsc);
+		}, [](const Pair <T> &x, const Pair <T> &y){ return x.key < y.key; });
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Descending sort order of key and value records                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static size_t SortKeyDsc (const string &input, const string &output, size_t run_size = RUN_SIZE, size_t buffer_size = MERGE_SIZE, bool direct = false) {
+		return Sort <Pair <T>> (input, output, run_size, buffer_size, direct, [](Pair <T> pairs[], size_t size){
+			SortPairs (pairs, size, Array::RadixSortKeyDsc);
+		}, [](const Pair <T> &x, const Pair <T> &y){ return x.key > y.key; });
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
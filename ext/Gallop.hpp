@@ -0,0 +1,90 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                      GALLOPING SEARCH IN SORTED ARRAYS                       #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<algorithm>
+# include	<Array.h>
+
+using namespace std;
+
+//****************************************************************************//
+//      Galloping search in sorted arrays                                     //
+//****************************************************************************//
+
+// Finds a bound of a value in a sorted array, starting from a known position
+// before it: steps 1, 2, 4... from the start bracket the bound, and the Array::
+// binary search finishes it in the bracketed range. A search that ends "d"
+// elements after the start costs O(log d), so a sweep of sorted queries over
+// the array costs O(m log(n / m)) instead of O(m log n). The lower bound is the
+// first element that does not go before the value in the sort order, and the
+// upper bound is the first element that goes after it. All the functions
+// return "size" if there is no such element.
+class Gallop
+{
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Bound of the value in the sort order                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static size_t Bound (const T array[], size_t size, size_t start, T value, bool upper, bool ascending) {
+		auto before = [=](T element){
+			if (ascending)
+				return upper ? element <= value : element < value;
+			else
+				return upper ? element >= value : element > value;
+		};
+		size_t bound = 1;
+		while (start + bound < size && before (array[start + bound]))
+			bound *= 2;
+		const size_t low = start + bound / 2;
+		const size_t high = min (start + bound + 1, size);
+		if (low >= high)
+			return size;
+		size_t index;
+		if (ascending)
+			index = upper ? Array::FindGreatAsc (array + low, high - low, value) : Array::FindGreatOrEqualAsc (array + low, high - low, value);
+		else
+			index = upper ? Array::FindLessDsc (array + low, high - low, value) : Array::FindLessOrEqualDsc (array + low, high - low, value);
+		return index == static_cast <size_t> (-1) ? high : low + index;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Ascending sort order                                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static size_t LowerAsc (const T array[], size_t size, size_t start, T value) {
+		return Bound (array, size, start, value, false, true);
+	}
+	template <typename T>
+	static size_t UpperAsc (const T array[], size_t size, size_t start, T value) {
+		return Bound (array, size, start, value, true, true);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Descending sort order                                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static size_t LowerDsc (const T array[], size_t size, size_t start, T value) {
+		return Bound (array, size, start, value, false, false);
+	}
+	template <typename T>
+	static size_t UpperDsc (const T array[], size_t size, size_t start, T value) {
+		return Bound (array, size, start, value, true, false);
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
\ No newline at end of file
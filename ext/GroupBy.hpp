@@ -0,0 +1,210 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                             GROUP-BY AGGREGATION                             #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<vector>
+# include	<type_traits>
+# include	<Array.h>
+# include	"HashTable.hpp"
+# include	"HashDistinct.hpp"
+# include	"Permutation.hpp"
+
+using namespace std;
+
+//****************************************************************************//
+//      Group-by aggregation                                                  //
+//****************************************************************************//
+
+// Computes COUNT, SUM, MIN and MAX of a value column grouped by an integer key
+// column. The sort path clusters the rows by Array::RadixSortKeyAsc with the
+// row indices as the pointer payload, finds the groups and their row counts by
+// Array::Duplicates, and aggregates each run of the gathered values by
+// Array::Sum and Array::MinMax. The hash path reads the rows once and keeps the
+// aggregates in an open addressing HashTable, which is much faster while the
+// table of groups stays in the cache. The automatic choice takes the sort
+// path at once if no key repeats in a sample of rows, checked by
+// HashDistinct::Unique, which means far more groups than the cache holds.
+// Otherwise it takes the hash path, but falls back to the sort path as soon as
+// the table gets more than HASH_GROUPS groups. Both paths return the groups in
+// the ascending key order. The paths add the values in different orders, so
+// floating-point sums are equal only within the rounding error. The target
+// arrays must have room for as many groups as rows.
+class GroupBy
+{
+//============================================================================//
+//      Types                                                                 //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Algorithm of the aggregation                                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	enum Method
+	{
+		AUTO,					// Choose by the count of groups
+		SORT,					// Sort the rows by the key
+		HASH					// Aggregate the rows in a hash table
+	};
+
+//============================================================================//
+//      Constants                                                             //
+//============================================================================//
+public:
+	static constexpr size_t HASH_GROUPS = 1 << 16;	// Max count of groups of the automatic hash path
+	static constexpr size_t SAMPLE_SIZE = 1 << 10;	// Count of sampled rows
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Sum of the values                                                     //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename V>
+	static V Sum (const V value[], size_t size) {
+		if constexpr (is_floating_point_v <V>)
+			return Array::Sum (value, size);
+		else {
+			V sum = 0;
+			for (size_t i = 0; i < size; i++)
+				sum += value[i];
+			return sum;
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Check if the keys of a sample of rows repeat                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename K>
+	static bool IsRepeated (const K key[], size_t size) {
+		if (size <= SAMPLE_SIZE)
+			return true;
+		vector <K> sample (SAMPLE_SIZE), unique (SAMPLE_SIZE);
+		const size_t step = size / SAMPLE_SIZE;
+		for (size_t i = 0; i < SAMPLE_SIZE; i++)
+			sample[i] = key[i * step];
+		return HashDistinct::Unique (unique.data(), sample.data(), SAMPLE_SIZE) < SAMPLE_SIZE;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Aggregation by sorting                                                //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename K, typename V>
+	static size_t SortGroups (K group[], size_t count[], V sum[], V min[], V max[], const K key[], const V value[], size_t size) {
+
+		// Cluster the row indices by the key
+		vector <K> keys (key, key + size), tkeys (size);
+		vector <const void*> rows (size), trows (size);
+		for (size_t i = 0; i < size; i++)
+			rows[i] = reinterpret_cast <const void*> (i);
+		Array::RadixSortKeyAsc (keys.data(), rows.data(), tkeys.data(), trows.data(), size);
+
+		// Gather the values in the key order
+		vector <V> values (size);
+		for (size_t i = 0; i < size; i++)
+			values[i] = value[reinterpret_cast <size_t> (rows[i])];
+
+		// Aggregate the runs of equal keys
+		const size_t groups = Array::Duplicates (group, count, keys.data(), size);
+		const V *run = values.data();
+		for (size_t g = 0; g < groups; g++) {
+			sum[g] = Sum (run, count[g]);
+			Array::MinMax (run, count[g], min[g], max[g]);
+			run += count[g];
+		}
+		return groups;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Aggregation in a hash table                                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Returns -1 if there are more groups than the limit
+	template <typename K, typename V>
+	static size_t HashGroups (K group[], size_t count[], V sum[], V min[], V max[], const K key[], const V value[], size_t size, size_t limit) {
+		HashTable <K> table;
+		vector <size_t> counts;
+		vector <V> sums, mins, maxs;
+		for (size_t i = 0; i < size; i++) {
+			const V v = value[i];
+			const size_t g = table.Insert (key[i], limit);
+			if (g == HashTable <K>::NONE)
+				return static_cast <size_t> (-1);
+			if (g < counts.size()) {
+				counts[g]++;
+				sums[g] += v;
+				mins[g] = v < mins[g] ? v : mins[g];
+				maxs[g] = v > maxs[g] ? v : maxs[g];
+			}
+			else {
+				counts.push_back (1);
+				sums.push_back (v);
+				mins.push_back (v);
+				maxs.push_back (v);
+			}
+		}
+
+		// Write the groups in the key order
+		const size_t groups = table.Size();
+		const K *keys = table.Keys();
+		vector <size_t> order (groups);
+		Permutation::ArgsortAsc (order.data(), keys, groups);
+		for (size_t g = 0; g < groups; g++) {
+			const size_t j = order[g];
+			group[g] = keys[j];
+			count[g] = counts[j];
+			sum[g] = sums[j];
+			min[g] = mins[j];
+			max[g] = maxs[j];
+		}
+		return groups;
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Aggregate the values by the key                                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Returns the count of groups
+	template <typename K, typename V>
+	static size_t Aggregate (
+		K group[],				// Target array of the group keys
+		size_t count[],			// Target array of the row counts
+		V sum[],				// Target array of the sums
+		V min[],				// Target array of the min values
+		V max[],				// Target array of the max values
+		const K key[],			// Key column
+		const V value[],		// Value column
+		size_t size,			// Count of rows
+		Method method = AUTO	// Algorithm of the aggregation
+	){
+		switch (method) {
+			case SORT:
+				return SortGroups (group, count, sum, min, max, key, value, size);
+			case HASH:
+				return HashGroups (group, count, sum, min, max, key, value, size, size);
+			default:
+				if (IsRepeated (key, size)) {
+					const size_t groups = HashGroups (group, count, sum, min, max, key, value, size, HASH_GROUPS);
+					if (groups != static_cast <size_t> (-1))
+						return groups;
+				}
+				return SortGroups (group, count, sum, min, max, key, value, size);
+		}
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,203 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                HASH-BASED DISTINCT VALUES OF UNSORTED ARRAYS                 #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<vector>
+# include	<bit>
+# include	<algorithm>
+# include	<type_traits>
+# include	<Array.h>
+# include	"HashTable.hpp"
+
+using namespace std;
+
+//****************************************************************************//
+//      Hash-based distinct values of unsorted arrays                         //
+//****************************************************************************//
+
+// Extracts the distinct values of an unsorted array and counts their
+// duplicates, like Array::Unique and Array::Duplicates do for a sorted array,
+// but without sorting it. The values are keyed by their bits, so floating-point
+// values are equal only if their bits are equal: 0.0 and -0.0 are distinct, and
+// NaNs of the same bits are merged. The 8-bit and 16-bit values are counted in
+// a table indexed by the bits. Wider values go to an open addressing HashTable,
+// which first gets the "slots" slots, small enough to stay in the cache. If the
+// values do not fit there, the array is radix partitioned by the top bits of
+// the hashes, so each partition has its own small table, and the tables grow
+// only for the partitions of many distinct values. The order of the distinct
+// values is unspecified: sort them to get the output of the Array:: functions.
+class HashDistinct
+{
+//============================================================================//
+//      Constants                                                             //
+//============================================================================//
+public:
+	static constexpr size_t TABLE_SIZE = 1 << 14;	// Default count of slots of a table
+	static constexpr size_t MAX_FANOUT = 1024;		// Max count of partitions
+
+//============================================================================//
+//      Types                                                                 //
+//============================================================================//
+private:
+	template <typename T>
+	using Word = conditional_t <sizeof (T) == 1, uint8_t,
+		conditional_t <sizeof (T) == 2, uint16_t,
+		conditional_t <sizeof (T) == 4, uint32_t, uint64_t>>>;
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count the value bits in the hash table                                //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Returns false if the value is new and the table has the "limit" count of
+	// values
+	template <typename U>
+	static bool Add (HashTable <U> &table, vector <size_t> &counts, U key, size_t limit = HashTable <U>::NONE) {
+		const size_t index = table.Insert (key, limit);
+		if (index == HashTable <U>::NONE)
+			return false;
+		if (index == counts.size())
+			counts.push_back (1);
+		else
+			counts[index]++;
+		return true;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Move the values and their counts to the arrays                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Clears the table and the counts
+	template <typename T, typename U>
+	static size_t Extract (T unique[], size_t count[], HashTable <U> &table, vector <size_t> &counts) {
+		const size_t n = table.Size();
+		const U *keys = table.Keys();
+		for (size_t i = 0; i < n; i++) {
+			unique[i] = bit_cast <T> (keys[i]);
+			if (count)
+				count[i] = counts[i];
+		}
+		table.Clear ();
+		counts.clear ();
+		return n;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count the values in a table indexed by their bits                     //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static size_t Direct (T unique[], size_t count[], const T array[], size_t size) {
+		typedef Word <T> U;
+		vector <size_t> table (size_t (1) << (8 * sizeof (T)));
+		for (size_t i = 0; i < size; i++)
+			table[bit_cast <U> (array[i])]++;
+		size_t n = 0;
+		for (size_t i = 0; i < table.size(); i++) {
+			if (table[i]) {
+				unique[n] = bit_cast <T> (static_cast <U> (i));
+				if (count)
+					count[n] = table[i];
+				n++;
+			}
+		}
+		return n;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count the values in the hash tables of the radix partitions           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static size_t Partitioned (T unique[], size_t count[], const T array[], size_t size, HashTable <Word <T>> &table, vector <size_t> &counts, size_t slots) {
+		typedef Word <T> U;
+
+		// Partitions of a quarter of the table slots
+		const size_t fanout = clamp (bit_ceil (size / max (slots / 4, size_t (1))), size_t (2), MAX_FANOUT);
+		const size_t shift = 64 - countr_zero (fanout);
+
+		// Histogram of the partitions and their start positions
+		vector <size_t> start (fanout + 1);
+		for (size_t i = 0; i < size; i++)
+			start[(HashTable <U>::Hash (bit_cast <U> (array[i])) >> shift) + 1]++;
+		for (size_t p = 0; p < fanout; p++)
+			start[p + 1] += start[p];
+
+		// Scatter the value bits to the partitions
+		vector <U> keys (size);
+		vector <size_t> pos (start.begin(), start.end() - 1);
+		for (size_t i = 0; i < size; i++) {
+			const U key = bit_cast <U> (array[i]);
+			keys[pos[HashTable <U>::Hash (key) >> shift]++] = key;
+		}
+
+		// Count each partition in the same table
+		size_t n = 0;
+		for (size_t p = 0; p < fanout; p++) {
+			for (size_t i = start[p]; i < start[p + 1]; i++)
+				Add (table, counts, keys[i]);
+			n += Extract (unique + n, count ? count + n : nullptr, table, counts);
+		}
+		return n;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count the values of the array                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static size_t Count (T unique[], size_t count[], const T array[], size_t size, size_t slots) {
+		typedef Word <T> U;
+		if constexpr (sizeof (T) <= 2)
+			return Direct (unique, count, array, size);
+		else {
+
+			// Try one table of the given size first, at most half full
+			slots = bit_ceil (max (slots, size_t (2)));
+			HashTable <U> table (slots);
+			vector <size_t> counts;
+			size_t i = 0;
+			while (i < size && Add (table, counts, bit_cast <U> (array[i]), slots / 2))
+				i++;
+			if (i == size)
+				return Extract (unique, count, table, counts);
+
+			// Too many distinct values for one table
+			table.Clear ();
+			counts.clear ();
+			return Partitioned (unique, count, array, size, table, counts, slots);
+		}
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Unique values                                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static size_t Unique (T unique[], const T array[], size_t size, size_t slots = TABLE_SIZE) {
+		return Count (unique, static_cast <size_t*> (nullptr), array, size, slots);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Duplicate values                                                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static size_t Duplicates (T unique[], size_t count[], const T array[], size_t size, size_t slots = TABLE_SIZE) {
+		return Count (unique, count, array, size, slots);
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
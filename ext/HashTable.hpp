@@ -0,0 +1,158 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                          HASH TABLE OF INTEGER KEYS                          #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<vector>
+# include	<bit>
+# include	<cstdint>
+# include	<algorithm>
+
+using namespace std;
+
+//****************************************************************************//
+//      Hash table of integer keys                                            //
+//****************************************************************************//
+
+// Open addressing table with linear probing, which numbers the integer keys in
+// the order of their insertion. Each slot holds a key with its number, so a
+// probe reads one slot only, and the keys are also kept in a dense array in the
+// order of their numbers: the callers keep the values of the keys (counts,
+// aggregates, codes) in their own arrays indexed by the numbers. The table has
+// a power of 2 slots and doubles when it gets more than half full. An insert
+// can be limited by a count of keys, so a table of a fixed size stays in the
+// cache. The slots are chosen by the splitmix64 finalizer of the key bits.
+template <typename K>
+class HashTable
+{
+//============================================================================//
+//      Constants                                                             //
+//============================================================================//
+public:
+	static constexpr size_t NONE = static_cast <size_t> (-1);	// No key number
+
+//============================================================================//
+//      Types                                                                 //
+//============================================================================//
+private:
+	struct Slot
+	{
+		K		key;		// Key
+		size_t	index;		// Number of the key plus one, or zero for an empty slot
+	};
+
+//============================================================================//
+//      Members                                                               //
+//============================================================================//
+private:
+	vector <Slot>	slots;		// Slots of the table
+	vector <K>		keys;		// Keys in the order of their numbers
+	size_t			mask;		// Mask of the slot index
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Add a new key to the empty slot                                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Kept out of line, so the probe loop stays small for the keys already in
+	// the table
+	[[gnu::noinline]] size_t Add (K key, size_t s, size_t limit) {
+		if (keys.size() == limit)
+			return NONE;
+		keys.push_back (key);
+		slots[s] = Slot {key, keys.size()};
+		if (2 * keys.size() > slots.size())
+			Grow ();
+		return keys.size() - 1;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Double the table size and rehash the keys                             //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void Grow (void) {
+		slots.assign (2 * slots.size(), Slot {});
+		mask = slots.size() - 1;
+		for (size_t k = 0; k < keys.size(); k++) {
+			size_t s = Hash (keys[k]) & mask;
+			while (slots[s].index)
+				s = (s + 1) & mask;
+			slots[s] = Slot {keys[k], k + 1};
+		}
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Constructor                                                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	HashTable (size_t size = 64)
+	:	slots (bit_ceil (max (size, size_t (2)))),
+		mask (slots.size() - 1)
+	{}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Hash of the key bits                                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// The finalizer of the splitmix64 generator, which is a bijection
+	static uint64_t Hash (uint64_t x) {
+		x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+		return x ^ (x >> 31);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count of keys                                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Size (void) const {
+		return keys.size();
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Keys in the order of their numbers                                    //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	const K* Keys (void) const {
+		return keys.data();
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Insert the key                                                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Returns the number of the key, which is the count of keys before the
+	// insert if the key is new. Returns NONE if the key is new and the table
+	// already has the "limit" count of keys
+	size_t Insert (K key, size_t limit = NONE) {
+		size_t s = Hash (key) & mask;
+		while (slots[s].index) {
+			if (slots[s].key == key)
+				return slots[s].index - 1;
+			s = (s + 1) & mask;
+		}
+		return Add (key, s, limit);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Remove all the keys                                                   //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// The table keeps its size
+	void Clear (void) {
+		fill (slots.begin(), slots.end(), Slot {});
+		keys.clear ();
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
\ No newline at end of file
@@ -0,0 +1,227 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                        LEARNED INDEX OF SORTED ARRAYS                        #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<vector>
+# include	<cmath>
+# include	<limits>
+# include	<type_traits>
+# include	<Array.h>
+
+using namespace std;
+
+//****************************************************************************//
+//      Learned index of sorted arrays                                        //
+//****************************************************************************//
+
+// Read-only index of an ascending integer array that predicts the position of a
+// key by a piecewise linear model instead of searching the whole array. The
+// segments are built in one pass by the shrinking cone method: a segment grows
+// while some slope from its first key keeps every covered key within "error"
+// positions from its predicted position. A query finds its segment by the Array::
+// binary search of the segment keys, and the last mile is the Array:: binary
+// search of the 2 * error + 2 elements around the predicted position. The
+// window is checked against its neighbours, so a miss caused by rounding or
+// duplicates falls back to the search of the whole array and is never wrong. The
+// index refers to the array, which must outlive it. The find functions have the
+// semantics of the Array:: binary searches for ascending arrays, and return -1
+// if nothing is found.
+template <typename T>
+class LearnedIndex
+{
+//============================================================================//
+//      Constants                                                             //
+//============================================================================//
+public:
+	static constexpr size_t DEFAULT_ERROR = 32;		// Default max error of the predicted positions
+
+//============================================================================//
+//      Members                                                               //
+//============================================================================//
+private:
+	typedef make_unsigned_t <T> U;
+	const T				*array;		// Indexed array
+	size_t				size;		// Count of elements in the array
+	size_t				error;		// Max error of the predicted positions
+	vector <T>			keys;		// First key of each segment
+	vector <size_t>		starts;		// Index of the first key of each segment
+	vector <flt64_t>	slopes;		// Slope of each segment
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Distance between two keys                                             //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static flt64_t Distance (T from, T to) {
+		return static_cast <flt64_t> (static_cast <U> (static_cast <U> (to) - static_cast <U> (from)));
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Predicted position of the value in the segment                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Predict (size_t segment, T value) const {
+		const size_t start = starts[segment];
+		const size_t end = segment + 1 < starts.size() ? starts[segment + 1] : size;
+		const flt64_t offset = round (slopes[segment] * Distance (keys[segment], value));
+		if (offset <= 0)
+			return start;
+		return min (start + static_cast <size_t> (offset), end);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Index of the first element that is greater (or equal) than the value  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Returns the count of elements if there is no such element
+	size_t Bound (T value, bool upper) const {
+		size_t segment = Array::FindLessOrEqualAsc (keys.data(), keys.size(), value);
+		if (segment == static_cast <size_t> (-1))
+			return 0;
+
+		// A run of equal keys may span segments: the first key of the run is
+		// in the first segment that starts with it, or in the segment before
+		if (!upper && keys[segment] == value) {
+			segment = Array::FindFirstEqualAsc (keys.data(), keys.size(), value);
+			const size_t start = starts[segment];
+			if (start == 0 || array[start - 1] != value)
+				return start;
+			segment--;
+		}
+
+		// Search the window around the predicted position
+		const size_t pos = Predict (segment, value);
+		const size_t low = pos > error ? pos - error - 1 : 0;
+		const size_t high = min (pos + error + 2, size);
+		size_t index = upper ?
+			Array::FindGreatAsc (array + low, high - low, value) :
+			Array::FindGreatOrEqualAsc (array + low, high - low, value);
+		index = index == static_cast <size_t> (-1) ? high : low + index;
+
+		// Check that the bound is not outside of the window
+		const bool left = index > low || low == 0 || (upper ? array[low - 1] <= value : array[low - 1] < value);
+		const bool right = index < high || high == size || (upper ? array[high] > value : array[high] >= value);
+		if (left && right)
+			return index;
+		index = upper ?
+			Array::FindGreatAsc (array, size, value) :
+			Array::FindGreatOrEqualAsc (array, size, value);
+		return index == static_cast <size_t> (-1) ? size : index;
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Constructor                                                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	LearnedIndex (const T array[], size_t size, size_t error = DEFAULT_ERROR)
+	:	array (array),
+		size (size),
+		error (error)
+	{
+		size_t i = 0;
+		while (i < size) {
+
+			// Shrink the cone of the allowed slopes by each next key
+			const size_t start = i;
+			flt64_t low = -numeric_limits <flt64_t>::infinity();
+			flt64_t high = numeric_limits <flt64_t>::infinity();
+			for (i = start + 1; i < size; i++) {
+				const flt64_t dx = Distance (array[start], array[i]);
+				const flt64_t dy = static_cast <flt64_t> (i - start);
+				if (dx == 0) {
+					if (dy > error)
+						break;
+					continue;
+				}
+				const flt64_t l = max (low, (dy - error) / dx);
+				const flt64_t h = min (high, (dy + error) / dx);
+				if (l > h)
+					break;
+				low = l;
+				high = h;
+			}
+
+			// Segment with the middle slope of the cone
+			keys.push_back (array[start]);
+			starts.push_back (start);
+			slopes.push_back (isinf (high) ? 0.0 : (low + high) / 2);
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count of segments                                                     //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Segments (void) const {
+		return keys.size();
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Memory used by the index (bytes)                                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Memory (void) const {
+		return keys.size() * (sizeof (T) + sizeof (size_t) + sizeof (flt64_t));
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Searching for the first equal element                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t FindFirstEqual (T value) const {
+		const size_t index = Bound (value, false);
+		return index < size && array[index] == value ? index : static_cast <size_t> (-1);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Searching for the last equal element                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t FindLastEqual (T value) const {
+		const size_t index = Bound (value, true);
+		return index > 0 && array[index - 1] == value ? index - 1 : static_cast <size_t> (-1);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Searching for a greater element                                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t FindGreat (T value) const {
+		const size_t index = Bound (value, true);
+		return index < size ? index : static_cast <size_t> (-1);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Searching for a greater or equal element                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t FindGreatOrEqual (T value) const {
+		const size_t index = Bound (value, false);
+		return index < size ? index : static_cast <size_t> (-1);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Searching for a less element                                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t FindLess (T value) const {
+		return Bound (value, false) - 1;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Searching for a less or equal element                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t FindLessOrEqual (T value) const {
+		return Bound (value, true) - 1;
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,136 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                       MULTI-COLUMN LEXICOGRAPHIC SORT                        #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<vector>
+# include	<functional>
+# include	<Array.h>
+
+using namespace std;
+
+//****************************************************************************//
+//      Multi-column lexicographic sort                                       //
+//****************************************************************************//
+
+// Sorts the rows of a table by several columns, the first column being the
+// most significant one. The row indices are carried as the pointer payload of
+// the stable Array:: key sorts, and the columns are sorted one by one from the
+// least significant one to the most significant one (LSD order). Before each
+// pass the keys of the column are gathered in the current row order, so each
+// column may have its own element type and sort order. The result is the row
+// permutation, and rows with all the columns equal keep their original order.
+class MultiColumnSort
+{
+//============================================================================//
+//      Types                                                                 //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Sort order of a column                                                //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	enum Order
+	{
+		ASC,					// Ascending sort order
+		DSC						// Descending sort order
+	};
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Stable key sort of the passes                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	enum Algorithm
+	{
+		RADIX,					// Array::RadixSortKeyAsc / RadixSortKeyDsc
+		MERGE					// Array::MergeSortKeyAsc / MergeSortKeyDsc
+	};
+
+//============================================================================//
+//      Members                                                               //
+//============================================================================//
+private:
+	typedef function <void (const void* rows[], const void* trows[], size_t size, Algorithm algorithm)> Pass;
+	vector <Pass>	passes;		// Sort passes of the columns, the most significant one first
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Sort the rows by the column                                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void SortColumn (
+		const T column[],		// Column of the table
+		Order order,			// Sort order of the column
+		const void* rows[],		// Rows in the current order
+		const void* trows[],	// Temporary array of rows
+		size_t size,			// Count of rows
+		Algorithm algorithm		// Key sort to use
+	){
+		vector <T> key (size), tkey (size);
+		for (size_t i = 0; i < size; i++)
+			key[i] = column[reinterpret_cast <size_t> (rows[i])];
+		if (algorithm == RADIX) {
+			if (order == ASC)
+				Array::RadixSortKeyAsc (key.data(), rows, tkey.data(), trows, size);
+			else
+				Array::RadixSortKeyDsc (key.data(), rows, tkey.data(), trows, size);
+		}
+		else {
+			if (order == ASC)
+				Array::MergeSortKeyAsc (key.data(), rows, tkey.data(), trows, size);
+			else
+				Array::MergeSortKeyDsc (key.data(), rows, tkey.data(), trows, size);
+		}
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Add the next less significant column                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	MultiColumnSort& Column (const T column[], Order order = ASC) {
+		passes.push_back ([column, order](const void* rows[], const void* trows[], size_t size, Algorithm algorithm){
+			SortColumn (column, order, rows, trows, size, algorithm);
+		});
+		return *this;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count of the columns                                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Columns (void) const {
+		return passes.size();
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Sort the rows                                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Writes the indices of the rows in the sorted order
+	void Sort (size_t rows[], size_t size, Algorithm algorithm = RADIX) const {
+		vector <const void*> order (size), temp (size);
+		for (size_t i = 0; i < size; i++)
+			order[i] = reinterpret_cast <const void*> (i);
+		for (size_t i = passes.size(); i > 0; i--)
+			passes[i - 1] (order.data(), temp.data(), size, algorithm);
+		for (size_t i = 0; i < size; i++)
+			rows[i] = reinterpret_cast <size_t> (order[i]);
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
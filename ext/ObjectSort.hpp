@@ -0,0 +1,101 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                        OBJECT SORT BY EXTRACTED KEYS                         #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<vector>
+# include	<type_traits>
+# include	<Array.h>
+
+using namespace std;
+
+//****************************************************************************//
+//      Object sort by extracted keys                                         //
+//****************************************************************************//
+
+// Sorts an array of object pointers like Array::MergeSortObjAsc does, but the
+// comparisons are not made through the Cmp callback. A fixed-width key is
+// extracted from each object into a contiguous key array once, and the keys are
+// sorted by Array::RadixSortKeyAsc with the object pointers as the payload. The
+// key must agree with the callback: if key(a) < key(b), then func(a, b) < 0. When
+// the key is only a prefix of the object order, the runs of equal keys are sorted
+// by the callback with Array::MergeSortObjAsc. Both sorts are stable, so equal
+// objects keep their original order. The callback may be null if the key is the
+// whole object order.
+class ObjectSort
+{
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Sort the objects                                                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename F>
+	static void Sort (
+		const void* array[],	// Array of object pointers
+		const void* temp[],		// Temporary array of object pointers
+		size_t size,			// Count of objects
+		F key,					// Key extraction function
+		Cmp func,				// Compare function to break the ties (may be null)
+		bool ascending			// Sort order
+	){
+		typedef invoke_result_t <F, const void*> K;
+		vector <K> keys (size), tkeys (size);
+		for (size_t i = 0; i < size; i++)
+			keys[i] = key (array[i]);
+		if (ascending)
+			Array::RadixSortKeyAsc (keys.data(), array, tkeys.data(), temp, size);
+		else
+			Array::RadixSortKeyDsc (keys.data(), array, tkeys.data(), temp, size);
+
+		// Break the ties in the runs of equal keys
+		if (func) {
+			size_t start = 0;
+			for (size_t i = 1; i <= size; i++) {
+				if (i == size || keys[i] != keys[start]) {
+					if (i - start > 1) {
+						if (ascending)
+							Array::MergeSortObjAsc (array + start, temp + start, i - start, func);
+						else
+							Array::MergeSortObjDsc (array + start, temp + start, i - start, func);
+					}
+					start = i;
+				}
+			}
+		}
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Ascending sort order                                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename F>
+	static void SortAsc (const void* array[], const void* temp[], size_t size, F key, Cmp func = nullptr) {
+		Sort (array, temp, size, key, func, true);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Descending sort order                                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename F>
+	static void SortDsc (const void* array[], const void* temp[], size_t size, F key, Cmp func = nullptr) {
+		Sort (array, temp, size, key, func, false);
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
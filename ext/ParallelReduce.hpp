@@ -0,0 +1,258 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                       PARALLEL REDUCTIONS OVER ARRAYS                        #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<Array.h>
+# include	"ThreadPool.hpp"
+
+//****************************************************************************//
+//      Parallel reductions over arrays                                       //
+//****************************************************************************//
+
+// Splits an array into chunks aligned to cache lines, reduces each chunk with
+// the Array:: kernel on the thread pool and combines the partial results with
+// the same kernel. There are a few chunks per thread to balance the load, but a
+// chunk is never smaller than MIN_CHUNK bytes (one page), so small arrays are
+// reduced by the calling thread alone. The chunk boundaries depend on the
+// thread count, so the rounding of floating-point sums does too. The
+// reproducible sums use fixed leaves of LEAF_SIZE elements and a fixed
+// combining tree instead, so their results are bitwise identical for any count
+// of threads.
+class ParallelReduce
+{
+//============================================================================//
+//      Constants                                                             //
+//============================================================================//
+public:
+	static constexpr size_t CACHE_LINE = 64;			// Size of a cache line in bytes
+	static constexpr size_t MIN_CHUNK = 4096;			// Min chunk size in bytes
+	static constexpr size_t CHUNKS_PER_THREAD = 4;		// Chunks per thread for load balancing
+	static constexpr size_t LEAF_SIZE = 2048;			// Elements in a leaf of the reproducible sums
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Split the array into chunks aligned to cache lines                    //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static vector <size_t> Chunks (
+		ThreadPool &pool,		// Thread pool
+		const T array[],		// Array to split
+		size_t size				// Count of elements
+	){
+		// Count of chunks to split into
+		const size_t bytes = size * sizeof (T);
+		const size_t count = max <size_t> (1, min (pool.Size() * CHUNKS_PER_THREAD, bytes / MIN_CHUNK));
+
+		// Boundaries of the chunks. Each inner boundary is moved forward to
+		// the start of a cache line
+		const uintptr_t base = reinterpret_cast <uintptr_t> (array);
+		vector <size_t> bounds (count + 1, size);
+		bounds[0] = 0;
+		for (size_t i = 1; i < count; i++) {
+			uintptr_t address = base + bytes / count * i;
+			address = (address + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+			bounds[i] = min (size, (address - base) / sizeof (T));
+		}
+		return bounds;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Reduce the chunks with the function and collect the partial results   //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename R, typename T, typename F>
+	static vector <R> Partials (
+		ThreadPool &pool,		// Thread pool
+		const T array[],		// Array to reduce
+		size_t size,			// Count of elements
+		F func					// Chunk reduction function
+	){
+		const vector <size_t> bounds = Chunks (pool, array, size);
+		vector <R> partials (bounds.size() - 1);
+		pool.Run (partials.size(), [&](size_t i){
+			partials[i] = func (bounds[i], bounds[i + 1] - bounds[i]);
+		});
+		return partials;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Reduce the fixed leaves with the function and combine them with the tree//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T, typename F>
+	static T Tree (
+		ThreadPool &pool,		// Thread pool
+		size_t size,			// Count of elements
+		F func					// Leaf reduction function
+	){
+		// Leaves are independent of the thread count. Each task takes a range
+		// of consecutive leaves to keep the tasks large enough
+		const size_t leaves = max <size_t> (1, (size + LEAF_SIZE - 1) / LEAF_SIZE);
+		const size_t tasks = min (leaves, pool.Size() * CHUNKS_PER_THREAD);
+		vector <T> partials (leaves);
+		pool.Run (tasks, [&](size_t i){
+			for (size_t leaf = leaves * i / tasks; leaf < leaves * (i + 1) / tasks; leaf++) {
+				const size_t offset = leaf * LEAF_SIZE;
+				partials[leaf] = func (offset, min (LEAF_SIZE, size - offset));
+			}
+		});
+
+		// Fold the upper half of the partial sums onto the lower half until
+		// there is a single value. The tree depends on the leaf count only
+		size_t count = leaves;
+		while (count > 1) {
+			const size_t half = count / 2;
+			Array::AddVector (partials.data(), partials.data() + count - half, half);
+			count -= half;
+		}
+		return partials[0];
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Sum of values                                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static T Sum (ThreadPool &pool, const T array[], size_t size) {
+		vector <T> partials = Partials <T> (pool, array, size, [&](size_t offset, size_t count){
+			return Array::Sum (array + offset, count);
+		});
+		return Array::Sum (partials.data(), partials.size());
+	}
+	template <typename T>
+	static T Sum (const T array[], size_t size) {
+		return Sum (ThreadPool::Default (), array, size);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Sum of squared values                                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static T SumSqr (ThreadPool &pool, const T array[], size_t size) {
+		vector <T> partials = Partials <T> (pool, array, size, [&](size_t offset, size_t count){
+			return Array::SumSqr (array + offset, count);
+		});
+		return Array::Sum (partials.data(), partials.size());
+	}
+	template <typename T>
+	static T SumSqr (const T array[], size_t size) {
+		return SumSqr (ThreadPool::Default (), array, size);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Sum of multiplied values                                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static T SumMul (ThreadPool &pool, const T array1[], const T array2[], size_t size) {
+		vector <T> partials = Partials <T> (pool, array1, size, [&](size_t offset, size_t count){
+			return Array::SumMul (array1 + offset, array2 + offset, count);
+		});
+		return Array::Sum (partials.data(), partials.size());
+	}
+	template <typename T>
+	static T SumMul (const T array1[], const T array2[], size_t size) {
+		return SumMul (ThreadPool::Default (), array1, array2, size);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Reproducible sum of values                                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static T ReproducibleSum (ThreadPool &pool, const T array[], size_t size) {
+		return Tree <T> (pool, size, [&](size_t offset, size_t count){
+			return Array::Sum (array + offset, count);
+		});
+	}
+	template <typename T>
+	static T ReproducibleSum (const T array[], size_t size) {
+		return ReproducibleSum (ThreadPool::Default (), array, size);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Reproducible sum of squared values                                    //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static T ReproducibleSumSqr (ThreadPool &pool, const T array[], size_t size) {
+		return Tree <T> (pool, size, [&](size_t offset, size_t count){
+			return Array::SumSqr (array + offset, count);
+		});
+	}
+	template <typename T>
+	static T ReproducibleSumSqr (const T array[], size_t size) {
+		return ReproducibleSumSqr (ThreadPool::Default (), array, size);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Minimum value                                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static T Min (ThreadPool &pool, const T array[], size_t size) {
+		if (!size)
+			return Array::Min (array, size);
+		vector <T> partials = Partials <T> (pool, array, size, [&](size_t offset, size_t count){
+			return Array::Min (array + offset, count);
+		});
+		return Array::Min (partials.data(), partials.size());
+	}
+	template <typename T>
+	static T Min (const T array[], size_t size) {
+		return Min (ThreadPool::Default (), array, size);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Maximum value                                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static T Max (ThreadPool &pool, const T array[], size_t size) {
+		if (!size)
+			return Array::Max (array, size);
+		vector <T> partials = Partials <T> (pool, array, size, [&](size_t offset, size_t count){
+			return Array::Max (array + offset, count);
+		});
+		return Array::Max (partials.data(), partials.size());
+	}
+	template <typename T>
+	static T Max (const T array[], size_t size) {
+		return Max (ThreadPool::Default (), array, size);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Both minimum and maximum values                                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void MinMax (ThreadPool &pool, const T array[], size_t size, T &min, T &max) {
+		if (!size) {
+			Array::MinMax (array, size, min, max);
+			return;
+		}
+		const vector <size_t> bounds = Chunks (pool, array, size);
+		vector <T> mins (bounds.size() - 1), maxs (bounds.size() - 1);
+		pool.Run (mins.size(), [&](size_t i){
+			Array::MinMax (array + bounds[i], bounds[i + 1] - bounds[i], mins[i], maxs[i]);
+		});
+		min = Array::Min (mins.data(), mins.size());
+		max = Array::Max (maxs.data(), maxs.size());
+	}
+	template <typename T>
+	static void MinMax (const T array[], size_t size, T &min, T &max) {
+		MinMax (ThreadPool::Default (), array, size, min, max);
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
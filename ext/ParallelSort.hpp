@@ -0,0 +1,256 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                           PARALLEL SORT OF ARRAYS                            #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<Array.h>
+# include	"ThreadPool.hpp"
+
+//****************************************************************************//
+//      Parallel sort of arrays                                               //
+//****************************************************************************//
+
+// Splits an array into one run per thread, sorts the runs with the Array::
+// radix sort on the thread pool and then merges adjacent runs pairwise until
+// there is a single run. Each merge is cut into pieces of equal output size
+// with the merge path search, so all the threads take part in every merge
+// pass, even the last one. The passes ping-pong between the array and the
+// temporary array, and the result is copied back if it ends in the latter.
+// Small arrays are sorted by the calling thread alone. The key sorts carry
+// a pointer with each key through the runs and the merges.
+class ParallelSort
+{
+//============================================================================//
+//      Constants                                                             //
+//============================================================================//
+public:
+	static constexpr size_t MIN_RUN = 4096;				// Min run size in bytes
+	static constexpr size_t PIECES_PER_THREAD = 4;		// Merge pieces per thread for load balancing
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Merge path search                                                     //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Returns the count of elements taken from the first run among the first
+	// "diag" elements of the merged output. Equal elements are taken from the
+	// first run first, so the merge is stable
+	template <typename T, typename C>
+	static size_t Split (
+		const T first[],		// First sorted run
+		size_t fsize,			// Count of elements in the first run
+		const T second[],		// Second sorted run
+		size_t ssize,			// Count of elements in the second run
+		size_t diag,			// Count of merged elements
+		C comp					// Order of the runs
+	){
+		size_t lo = diag > ssize ? diag - ssize : 0;
+		size_t hi = min (diag, fsize);
+		while (lo < hi) {
+			const size_t mid = (lo + hi) / 2;
+			if (comp (second[diag - mid - 1], first[mid]))
+				hi = mid;
+			else
+				lo = mid + 1;
+		}
+		return lo;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Merge two sorted runs of keys and pointers                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T, typename C>
+	static void Merge (
+		T key[],				// Target array of keys
+		const void* ptr[],		// Target array of pointers
+		const T fkey[],			// Keys of the first run
+		const void* fptr[],		// Pointers of the first run
+		size_t fsize,			// Count of elements in the first run
+		const T skey[],			// Keys of the second run
+		const void* sptr[],		// Pointers of the second run
+		size_t ssize,			// Count of elements in the second run
+		C comp					// Order of the runs
+	){
+		size_t i = 0, j = 0, k = 0;
+		while (i < fsize && j < ssize) {
+			if (comp (skey[j], fkey[i])) {
+				key[k] = skey[j];
+				ptr[k++] = sptr[j++];
+			}
+			else {
+				key[k] = fkey[i];
+				ptr[k++] = fptr[i++];
+			}
+		}
+		for (; i < fsize; i++, k++) {
+			key[k] = fkey[i];
+			ptr[k] = fptr[i];
+		}
+		for (; j < ssize; j++, k++) {
+			key[k] = skey[j];
+			ptr[k] = sptr[j];
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Sort the runs and merge them                                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// The pointers are moved together with their keys. With no pointers (a
+	// null pointer array) only the keys are sorted
+	template <typename T, typename S, typename C>
+	static void Sort (
+		ThreadPool &pool,		// Thread pool
+		T key[],				// Array of keys to sort
+		const void* ptr[],		// Array of pointers or null
+		T tkey[],				// Temporary array of keys
+		const void* tptr[],		// Temporary array of pointers or null
+		size_t size,			// Count of elements
+		S sort,					// Run sort function
+		C comp					// Order of the sort
+	){
+		// Count of runs to split into
+		const size_t runs = max <size_t> (1, min (pool.Size(), size * sizeof (T) / MIN_RUN));
+		if (runs == 1) {
+			sort (0, size);
+			return;
+		}
+
+		// Sort the runs
+		vector <size_t> bounds (runs + 1);
+		for (size_t i = 0; i <= runs; i++)
+			bounds[i] = size * i / runs;
+		pool.Run (runs, [&](size_t i){
+			sort (bounds[i], bounds[i + 1] - bounds[i]);
+		});
+
+		// Merge adjacent runs until there is a single run left. A lone last
+		// run is merged with nothing, which just copies it to the target
+		const size_t piece = max (MIN_RUN / sizeof (T), size / (pool.Size() * PIECES_PER_THREAD));
+		T *source = key;
+		T *target = tkey;
+		const void* *psource = ptr;
+		const void* *ptarget = tptr;
+		struct Piece {size_t run, start, end;};
+		vector <Piece> pieces;
+		while (bounds.size() > 2) {
+			pieces.clear ();
+			for (size_t r = 0; r + 1 < bounds.size(); r += 2) {
+				const size_t end = bounds[min (r + 2, bounds.size() - 1)];
+				for (size_t start = bounds[r]; start < end; start += piece)
+					pieces.push_back ({r, start, min (start + piece, end)});
+			}
+			pool.Run (pieces.size(), [&](size_t i){
+				const Piece &p = pieces[i];
+				const size_t begin = bounds[p.run];
+				const size_t middle = bounds[p.run + 1];
+				const size_t end = p.run + 2 < bounds.size() ? bounds[p.run + 2] : middle;
+				const T *first = source + begin;
+				const T *second = source + middle;
+				const size_t fstart = Split (first, middle - begin, second, end - middle, p.start - begin, comp);
+				const size_t fend = Split (first, middle - begin, second, end - middle, p.end - begin, comp);
+				const size_t sstart = p.start - begin - fstart;
+				const size_t send = p.end - begin - fend;
+				if (psource)
+					Merge (target + p.start, ptarget + p.start,
+						first + fstart, psource + begin + fstart, fend - fstart,
+						second + sstart, psource + middle + sstart, send - sstart, comp);
+				else
+					merge (first + fstart, first + fend, second + sstart, second + send, target + p.start, comp);
+			});
+			vector <size_t> merged;
+			for (size_t r = 0; r < bounds.size(); r += 2)
+				merged.push_back (bounds[r]);
+			if (merged.back() != size)
+				merged.push_back (size);
+			bounds.swap (merged);
+			swap (source, target);
+			swap (psource, ptarget);
+		}
+
+		// Copy the result back to the arrays
+		if (source != key) {
+			pool.Run ((size + piece - 1) / piece, [&](size_t i){
+				const size_t start = i * piece;
+				const size_t count = min (piece, size - start);
+				Array::Copy (key + start, source + start, count);
+				if (psource)
+					copy (psource + start, psource + start + count, ptr + start);
+			});
+		}
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Ascending sort order                                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void SortAsc (ThreadPool &pool, T array[], T temp[], size_t size) {
+		Sort (pool, array, nullptr, temp, nullptr, size, [&](size_t offset, size_t count){
+			Array::RadixSortAsc (array + offset, temp + offset, count);
+		}, less <T> ());
+	}
+	template <typename T>
+	static void SortAsc (T array[], T temp[], size_t size) {
+		SortAsc (ThreadPool::Default (), array, temp, size);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Descending sort order                                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void SortDsc (ThreadPool &pool, T array[], T temp[], size_t size) {
+		Sort (pool, array, nullptr, temp, nullptr, size, [&](size_t offset, size_t count){
+			Array::RadixSortDsc (array + offset, temp + offset, count);
+		}, greater <T> ());
+	}
+	template <typename T>
+	static void SortDsc (T array[], T temp[], size_t size) {
+		SortDsc (ThreadPool::Default (), array, temp, size);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Ascending sort order of keys with pointers                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void SortKeyAsc (ThreadPool &pool, T key[], const void* ptr[], T tkey[], const void* tptr[], size_t size) {
+		Sort (pool, key, ptr, tkey, tptr, size, [&](size_t offset, size_t count){
+			Array::RadixSortKeyAsc (key + offset, ptr + offset, tkey + offset, tptr + offset, count);
+		}, less <T> ());
+	}
+	template <typename T>
+	static void SortKeyAsc (T key[], const void* ptr[], T tkey[], const void* tptr[], size_t size) {
+		SortKeyAsc (ThreadPool::Default (), key, ptr, tkey, tptr, size);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Descending sort order of keys with pointers                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void SortKeyDsc (ThreadPool &pool, T key[], const void* ptr[], T tkey[], const void* tptr[], size_t size) {
+		Sort (pool, key, ptr, tkey, tptr, size, [&](size_t offset, size_t count){
+			Array::RadixSortKeyDsc (key + offset, ptr + offset, tkey + offset, tptr + offset, count);
+		}, greater <T> ());
+	}
+	template <typename T>
+	static void SortKeyDsc (T key[], const void* ptr[], T tkey[], const void* tptr[], size_t size) {
+		SortKeyDsc (ThreadPool::Default (), key, ptr, tkey, tptr, size);
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
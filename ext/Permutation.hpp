@@ -0,0 +1,108 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                         SORT PERMUTATIONS OF ARRAYS                          #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<vector>
+# include	<algorithm>
+# include	<Array.h>
+
+using namespace std;
+
+//****************************************************************************//
+//      Sort permutations of arrays                                           //
+//****************************************************************************//
+
+// Argsort finds the permutation that sorts the keys, leaving the keys as they
+// are. The row indices are the pointer payload of the Array:: radix key sort, so
+// the sort is stable. Gather applies the permutation to a column of any type:
+// target[i] = source[index[i]]. For large columns each load is a cache miss
+// and often a TLB miss, so the indices are processed in blocks and the source
+// elements of the next block are prefetched while the current block is copied.
+class Permutation
+{
+//============================================================================//
+//      Constants                                                             //
+//============================================================================//
+public:
+	static constexpr size_t GATHER_BLOCK = 64;		// Count of elements prefetched ahead by the gather
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Sort the row indices by the keys                                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void Argsort (
+		size_t index[],			// Target array of row indices
+		const T key[],			// Keys of the rows
+		size_t size,			// Count of rows
+		void (*func)(T key[], const void* ptr[], T tkey[], const void* tptr[], size_t size)
+	){
+		vector <T> keys (key, key + size), tkey (size);
+		vector <const void*> rows (size), trows (size);
+		for (size_t i = 0; i < size; i++)
+			rows[i] = reinterpret_cast <const void*> (i);
+		func (keys.data(), rows.data(), tkey.data(), trows.data(), size);
+		for (size_t i = 0; i < size; i++)
+			index[i] = reinterpret_cast <size_t> (rows[i]);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Prefetch the source elements of the index range                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void Prefetch (const T source[], const size_t index[], size_t start, size_t end) {
+		for (size_t i = start; i < end; i++)
+			__builtin_prefetch (source + index[i]);
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Ascending sort permutation                                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void ArgsortAsc (size_t index[], const T key[], size_t size) {
+		Argsort (index, key, size, Array::RadixSortKeyAsc);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Descending sort permutation                                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void ArgsortDsc (size_t index[], const T key[], size_t size) {
+		Argsort (index, key, size, Array::RadixSortKeyDsc);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Apply the permutation to the column                                   //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void Gather (T target[], const T source[], const size_t index[], size_t size) {
+		Prefetch (source, index, 0, min (GATHER_BLOCK, size));
+		for (size_t start = 0; start < size; start += GATHER_BLOCK) {
+			const size_t end = min (start + GATHER_BLOCK, size);
+			Prefetch (source, index, end, min (end + GATHER_BLOCK, size));
+			for (size_t i = start; i < end; i++)
+				target[i] = source[index[i]];
+		}
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,273 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                          RADIX PARTITION OF ARRAYS                           #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<vector>
+# include	<bit>
+# include	<cstring>
+# include	<cstdint>
+# include	<type_traits>
+# include	<Array.h>
+# ifdef	__SSE2__
+# include	<immintrin.h>
+# endif
+# include	"ThreadPool.hpp"
+
+using namespace std;
+
+//****************************************************************************//
+//      Radix partition of arrays                                             //
+//****************************************************************************//
+
+// Moves the keys of an array to 2^bits partitions by a digit of the keys, which
+// is one pass of an MSD radix sort and the partition step of radix hash joins.
+// The digit is taken at the "shift" bit from the keys mapped to unsigned
+// integers of the same order (the sign bit is flipped, and all the bits of
+// negative floating-point values), so the partitions follow the ascending order
+// of the digits for all the key types of the Array:: radix sort. The array is
+// split into one chunk per thread, but a chunk has at least "min_chunk" keys,
+// and each thread builds the histogram of its chunk. The prefix sums of the
+// histograms give each thread its own range of every partition, so the threads
+// scatter with no locks, and the partition is stable. A scatter to many
+// partitions touches many cache lines and TLB pages at once, so each thread
+// writes a partition to a buffer of one cache line first, and copies the whole
+// line to the target when it is full. The optional pointers are moved together
+// with their keys, through buffers of their own. The buffer lines of the keys
+// and of the pointers match the cache lines of their own target arrays, so the
+// copy uses streaming stores, which do not read the target lines into the
+// cache.
+class RadixPartition
+{
+//============================================================================//
+//      Constants                                                             //
+//============================================================================//
+public:
+	static constexpr size_t LINE_SIZE = 64;			// Size of the write-combining buffers (bytes)
+	static constexpr size_t MIN_CHUNK = 4096;		// Default min count of keys per thread
+
+//============================================================================//
+//      Types                                                                 //
+//============================================================================//
+private:
+
+	// Write-combining buffers of one target array, a line per partition. A
+	// line holds LINE_SIZE / sizeof (E) elements, and starts at a cache line of
+	// the target
+	template <typename E>
+	class Buffer
+	{
+	private:
+		static constexpr size_t LINE = LINE_SIZE / sizeof (E);	// Elements in a line
+
+		vector <E>		line;		// Lines of all the partitions
+		E				*target;	// Target array
+		const size_t	*start;		// Start positions of the chunk in the partitions
+		size_t			base;		// Position of the target in its cache line
+
+		// Copy the line of the partition to the target from the "end" position
+		// back to the line start or the chunk start
+		void Copy (size_t p, size_t end) {
+			const size_t last = end + base - 1;
+			const size_t first = max (last - last % LINE, start[p] + base);
+			memcpy (target + first - base, &line[p * LINE + first % LINE], (last + 1 - first) * sizeof (E));
+		}
+
+	public:
+		Buffer (E target[], const size_t start[], size_t fanout)
+		:	line (fanout * LINE),
+			target (target),
+			start (start),
+			base (reinterpret_cast <uintptr_t> (target) % LINE_SIZE / sizeof (E))
+		{}
+
+		// Put the element to the "pos" position of the target, and copy the
+		// line when it is full. Whole lines are copied by the streaming stores
+		void Put (size_t p, size_t pos, E value) {
+			const size_t index = (pos + base) % LINE;
+			line[p * LINE + index] = value;
+			if (index == LINE - 1) {
+				const size_t first = pos + base + 1 - LINE;
+				if (first < start[p] + base)
+					Copy (p, pos + 1);
+				else
+					StoreLine (target + first - base, &line[p * LINE], LINE_SIZE);
+			}
+		}
+
+		// Copy the partially filled line of the partition
+		void Flush (size_t p, size_t end) {
+			if ((end + base) % LINE && end > start[p])
+				Copy (p, end);
+		}
+	};
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Digit of the key                                                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static size_t Digit (T key, size_t shift, size_t mask) {
+		typedef conditional_t <sizeof (T) == 1, uint8_t,
+			conditional_t <sizeof (T) == 2, uint16_t,
+			conditional_t <sizeof (T) == 4, uint32_t, uint64_t>>> U;
+		const U sign = U (1) << (8 * sizeof (U) - 1);
+		U bits = bit_cast <U> (key);
+		if constexpr (is_floating_point_v <T>)
+			bits = bits & sign ? ~bits : bits | sign;
+		else if constexpr (is_signed_v <T>)
+			bits ^= sign;
+		return shift < 8 * sizeof (U) ? (bits >> shift) & mask : 0;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Copy a full buffer line to the target                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Streaming stores write the cache lines without reading them first
+	static void StoreLine (void *target, const void *line, size_t bytes) {
+# ifdef	__SSE2__
+		if (reinterpret_cast <uintptr_t> (target) % sizeof (__m128i) == 0) {
+			__m128i *t = reinterpret_cast <__m128i*> (target);
+			const __m128i *s = reinterpret_cast <const __m128i*> (line);
+			for (size_t i = 0; i < bytes / sizeof (__m128i); i++)
+				_mm_stream_si128 (t + i, _mm_loadu_si128 (s + i));
+			return;
+		}
+# endif
+		memcpy (target, line, bytes);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Scatter the chunk through the write-combining buffers                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void Scatter (
+		T target[],				// Target array of keys
+		const void* ptarget[],	// Target array of pointers or null
+		const T key[],			// Keys of the chunk
+		const void* ptr[],		// Pointers of the chunk or null
+		size_t size,			// Count of keys in the chunk
+		size_t shift,			// Position of the digit
+		size_t fanout,			// Count of partitions
+		const size_t start[]	// Start positions of the chunk in the partitions
+	){
+		// Fill the buffers in the order of the keys
+		Buffer <T> keys (target, start, fanout);
+		Buffer <const void*> pointers (ptarget, start, ptr ? fanout : 0);
+		vector <size_t> pos (start, start + fanout);
+		const size_t mask = fanout - 1;
+		for (size_t i = 0; i < size; i++) {
+			const size_t p = Digit (key[i], shift, mask);
+			keys.Put (p, pos[p], key[i]);
+			if (ptr)
+				pointers.Put (p, pos[p], ptr[i]);
+			pos[p]++;
+		}
+
+		// Flush the partially filled buffers
+		for (size_t p = 0; p < fanout; p++) {
+			keys.Flush (p, pos[p]);
+			if (ptr)
+				pointers.Flush (p, pos[p]);
+		}
+# ifdef	__SSE2__
+		_mm_sfence ();
+# endif
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Partition the keys and the pointers                                   //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void Partition (
+		ThreadPool &pool,		// Thread pool
+		T target[],				// Target array of keys
+		const void* ptarget[],	// Target array of pointers or null
+		const T key[],			// Array of keys
+		const void* ptr[],		// Array of pointers or null
+		size_t size,			// Count of keys
+		size_t bits,			// Count of bits of the digit
+		size_t shift,			// Position of the digit
+		size_t bounds[],		// Target array of the 2^bits + 1 partition bounds
+		size_t min_chunk		// Min count of keys per thread
+	){
+		const size_t fanout = size_t (1) << bits;
+		const size_t mask = fanout - 1;
+
+		// Split the array into chunks
+		const size_t chunks = max <size_t> (1, min (pool.Size(), size / max <size_t> (min_chunk, 1)));
+		vector <size_t> chunk (chunks + 1);
+		for (size_t c = 0; c <= chunks; c++)
+			chunk[c] = size * c / chunks;
+
+		// Histograms of the chunks
+		vector <size_t> start (chunks * fanout);
+		pool.Run (chunks, [&](size_t c){
+			size_t *hist = &start[c * fanout];
+			for (size_t i = chunk[c]; i < chunk[c + 1]; i++)
+				hist[Digit (key[i], shift, mask)]++;
+		});
+
+		// Prefix sums in the partition order, and the chunk order inside each
+		// partition
+		size_t sum = 0;
+		for (size_t p = 0; p < fanout; p++) {
+			bounds[p] = sum;
+			for (size_t c = 0; c < chunks; c++) {
+				const size_t count = start[c * fanout + p];
+				start[c * fanout + p] = sum;
+				sum += count;
+			}
+		}
+		bounds[fanout] = sum;
+
+		// Scatter the chunks
+		pool.Run (chunks, [&](size_t c){
+			Scatter (target, ptarget, key + chunk[c], ptr ? ptr + chunk[c] : nullptr, chunk[c + 1] - chunk[c], shift, fanout, &start[c * fanout]);
+		});
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Partition of keys                                                     //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void Partition (ThreadPool &pool, T target[], const T key[], size_t size, size_t bits, size_t shift, size_t bounds[], size_t min_chunk = MIN_CHUNK) {
+		Partition (pool, target, nullptr, key, nullptr, size, bits, shift, bounds, min_chunk);
+	}
+	template <typename T>
+	static void Partition (T target[], const T key[], size_t size, size_t bits, size_t shift, size_t bounds[], size_t min_chunk = MIN_CHUNK) {
+		Partition (ThreadPool::Default (), target, key, size, bits, shift, bounds, min_chunk);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Partition of keys with pointers                                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void PartitionKey (ThreadPool &pool, T target[], const void* ptarget[], const T key[], const void* ptr[], size_t size, size_t bits, size_t shift, size_t bounds[], size_t min_chunk = MIN_CHUNK) {
+		Partition (pool, target, ptarget, key, ptr, size, bits, shift, bounds, min_chunk);
+	}
+	template <typename T>
+	static void PartitionKey (T target[], const void* ptarget[], const T key[], const void* ptr[], size_t size, size_t bits, size_t shift, size_t bounds[], size_t min_chunk = MIN_CHUNK) {
+		PartitionKey (ThreadPool::Default (), target, ptarget, key, ptr, size, bits, shift, bounds, min_chunk);
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,646 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#           COMPRESSED BITMAP WITH ARRAY, BITMAP AND RUN CONTAINERS            #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<Array.h>
+# include	<BitField.h>
+# include	<vector>
+# include	<algorithm>
+# include	<bit>
+
+using namespace std;
+
+//****************************************************************************//
+//      Compressed (Roaring-style) bitmap                                     //
+//****************************************************************************//
+
+// The bit positions are split into 64K chunks. Each non-empty chunk is kept in
+// the cheapest container: a sorted array of 16-bit values for sparse chunks,
+// a plain 64K bit field for dense chunks, or a list of runs for chunks where
+// the set bits form long intervals. Bitmap containers are processed by the
+// BitField functions.
+class RoaringBitmap
+{
+//============================================================================//
+//      Constants                                                             //
+//============================================================================//
+public:
+	static constexpr size_t CHUNK_BITS = 65536;				// Bits in a chunk
+	static constexpr size_t CHUNK_WORDS = CHUNK_BITS / 64;	// 64-bit words in a bitmap container
+	static constexpr size_t ARRAY_LIMIT = 4096;				// Max cardinality of an array container
+	static constexpr size_t NOT_FOUND = static_cast <size_t> (-1);
+
+	// Container types
+	enum Type {
+		ARRAY,				// Sorted array of set bit positions
+		BITMAP,				// Plain bit field
+		RUN					// Sorted list of set bit intervals
+	};
+
+//============================================================================//
+//      Container of a single chunk                                           //
+//============================================================================//
+private:
+	struct Container
+	{
+		Type				type;		// Container type
+		size_t				key;		// Chunk index (position / CHUNK_BITS)
+		size_t				count;		// Count of set bits in the chunk
+		vector <uint16_t>	values;		// Array values or run starts
+		vector <uint16_t>	ends;		// Run ends (inclusive)
+		vector <uint64_t>	bits;		// Bit field of the bitmap container
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Constructor                                                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+		Container (size_t key)
+		:	type (ARRAY),
+			key (key),
+			count (0)
+		{}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Index of the first value which is greater or equal to the bound       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+		static size_t LowerBound (const vector <uint16_t> &array, size_t bound) {
+			if (bound >= CHUNK_BITS)
+				return array.size();
+			size_t index = Array::FindGreatOrEqualAsc (array.data(), array.size(), static_cast <uint16_t> (bound));
+			return index == NOT_FOUND ? array.size() : index;
+		}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Get bit value                                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+		bool Get (size_t pos) const {
+			switch (type) {
+				case ARRAY:
+					return Array::FindFirstEqualAsc (values.data(), values.size(), static_cast <uint16_t> (pos)) != NOT_FOUND;
+				case BITMAP:
+					return BitField::GetBit (bits.data(), pos);
+				default: {
+					size_t index = Array::FindLessOrEqualAsc (values.data(), values.size(), static_cast <uint16_t> (pos));
+					return index != NOT_FOUND && ends[index] >= pos;
+				}
+			}
+		}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count set bits in the range [spos, epos)                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+		size_t Count (size_t spos, size_t epos) const {
+			if (spos == 0 && epos == CHUNK_BITS)
+				return count;
+			switch (type) {
+				case ARRAY:
+					return LowerBound (values, epos) - LowerBound (values, spos);
+				case BITMAP:
+					return BitField::CountBits (bits.data(), spos, epos);
+				default: {
+					size_t total = 0;
+					for (size_t i = LowerBound (ends, spos); i < values.size() && values[i] < epos; i++)
+						total += min <size_t> (ends[i] + 1, epos) - max <size_t> (values[i], spos);
+					return total;
+				}
+			}
+		}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Find the first set bit in the range [spos, epos)                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+		size_t Find (size_t spos, size_t epos) const {
+			switch (type) {
+				case ARRAY: {
+					size_t index = LowerBound (values, spos);
+					if (index < values.size() && values[index] < epos)
+						return values[index];
+					return NOT_FOUND;
+				}
+				case BITMAP:
+					return BitField::FindSetBitFwd (bits.data(), spos, epos);
+				default: {
+					size_t index = LowerBound (ends, spos);
+					if (index < values.size()) {
+						size_t pos = max <size_t> (values[index], spos);
+						if (pos < epos)
+							return pos;
+					}
+					return NOT_FOUND;
+				}
+			}
+		}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count of runs (intervals of set bits)                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+		size_t Runs (void) const {
+			switch (type) {
+				case ARRAY: {
+					size_t runs = values.size() ? 1 : 0;
+					for (size_t i = 1; i < values.size(); i++)
+						runs += values[i] != values[i-1] + 1;
+					return runs;
+				}
+				case BITMAP: {
+					size_t runs = 0;
+					uint64_t carry = 0;
+					for (size_t i = 0; i < CHUNK_WORDS; i++) {
+						const uint64_t word = bits[i];
+						runs += popcount (word & ~((word << 1) | carry));
+						carry = word >> 63;
+					}
+					return runs;
+				}
+				default:
+					return values.size();
+			}
+		}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Size of the container payload in bytes                                //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+		size_t Bytes (void) const {
+			return values.capacity() * sizeof (uint16_t) +
+				ends.capacity() * sizeof (uint16_t) +
+				bits.capacity() * sizeof (uint64_t);
+		}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Convert the container to a bitmap container                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+		void ToBitmap (void) {
+			if (type == BITMAP)
+				return;
+			vector <uint64_t> field (CHUNK_WORDS, 0);
+			if (type == ARRAY) {
+				for (size_t i = 0; i < values.size(); i++)
+					BitField::SetBit (field.data(), values[i]);
+			}
+			else {
+				for (size_t i = 0; i < values.size(); i++)
+					BitField::SetBits (field.data(), values[i], ends[i] + 1);
+			}
+			bits.swap (field);
+			vector <uint16_t> ().swap (values);
+			vector <uint16_t> ().swap (ends);
+			type = BITMAP;
+		}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Convert the container to an array container                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+		void ToArray (void) {
+			if (type == ARRAY)
+				return;
+			vector <uint16_t> array;
+			array.reserve (count);
+			if (type == BITMAP) {
+				for (size_t i = 0; i < CHUNK_WORDS; i++) {
+					uint64_t word = bits[i];
+					while (word) {
+						array.push_back (static_cast <uint16_t> (i * 64 + countr_zero (word)));
+						word &= word - 1;
+					}
+				}
+			}
+			else {
+				for (size_t i = 0; i < values.size(); i++)
+					for (size_t pos = values[i]; pos <= ends[i]; pos++)
+						array.push_back (static_cast <uint16_t> (pos));
+			}
+			values.swap (array);
+			vector <uint16_t> ().swap (ends);
+			vector <uint64_t> ().swap (bits);
+			type = ARRAY;
+		}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Convert the container to a run container                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+		void ToRun (void) {
+			if (type == RUN)
+				return;
+			vector <uint16_t> starts, stops;
+			if (type == ARRAY) {
+				for (size_t i = 0; i < values.size(); i++) {
+					if (i && values[i] == stops.back() + 1)
+						stops.back() = values[i];
+					else {
+						starts.push_back (values[i]);
+						stops.push_back (values[i]);
+					}
+				}
+			}
+			else {
+				size_t pos = BitField::FindSetBitFwd (bits.data(), 0, CHUNK_BITS);
+				while (pos != NOT_FOUND) {
+					size_t end = BitField::FindResetBitFwd (bits.data(), pos, CHUNK_BITS);
+					if (end == NOT_FOUND)
+						end = CHUNK_BITS;
+					starts.push_back (static_cast <uint16_t> (pos));
+					stops.push_back (static_cast <uint16_t> (end - 1));
+					pos = BitField::FindSetBitFwd (bits.data(), end, CHUNK_BITS);
+				}
+			}
+			values.swap (starts);
+			ends.swap (stops);
+			vector <uint64_t> ().swap (bits);
+			type = RUN;
+		}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Convert the container to its cheapest representation                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+		void Optimize (void) {
+			const size_t run_bytes = Runs() * 2 * sizeof (uint16_t);
+			const size_t array_bytes = count <= ARRAY_LIMIT ? count * sizeof (uint16_t) : NOT_FOUND;
+			const size_t bitmap_bytes = CHUNK_WORDS * sizeof (uint64_t);
+			if (run_bytes < array_bytes && run_bytes < bitmap_bytes)
+				ToRun();
+			else if (array_bytes <= bitmap_bytes)
+				ToArray();
+			else
+				ToBitmap();
+			values.shrink_to_fit();
+			ends.shrink_to_fit();
+		}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Set bits in the range [spos, epos)                                    //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+		void Set (size_t spos, size_t epos) {
+			switch (type) {
+				case ARRAY: {
+					const size_t first = LowerBound (values, spos);
+					const size_t last = LowerBound (values, epos);
+					const size_t total = count - (last - first) + (epos - spos);
+					if (total > ARRAY_LIMIT) {
+						ToBitmap();
+						Set (spos, epos);
+						return;
+					}
+					vector <uint16_t> array;
+					array.reserve (total);
+					array.insert (array.end(), values.begin(), values.begin() + first);
+					for (size_t pos = spos; pos < epos; pos++)
+						array.push_back (static_cast <uint16_t> (pos));
+					array.insert (array.end(), values.begin() + last, values.end());
+					values.swap (array);
+					count = total;
+					break;
+				}
+				case BITMAP:
+					count += (epos - spos) - BitField::CountBits (bits.data(), spos, epos);
+					BitField::SetBits (bits.data(), spos, epos);
+					break;
+				default: {
+					vector <uint16_t> starts, stops;
+					size_t last = epos - 1;
+					bool inserted = false;
+					for (size_t i = 0; i < values.size(); i++) {
+						if (static_cast <size_t> (ends[i]) + 1 < spos) {
+							starts.push_back (values[i]);
+							stops.push_back (ends[i]);
+						}
+						else if (values[i] > last + 1) {
+							if (!inserted) {
+								starts.push_back (static_cast <uint16_t> (spos));
+								stops.push_back (static_cast <uint16_t> (last));
+								inserted = true;
+							}
+							starts.push_back (values[i]);
+							stops.push_back (ends[i]);
+						}
+						else {
+							spos = min <size_t> (spos, values[i]);
+							last = max <size_t> (last, ends[i]);
+						}
+					}
+					if (!inserted) {
+						starts.push_back (static_cast <uint16_t> (spos));
+						stops.push_back (static_cast <uint16_t> (last));
+					}
+					values.swap (starts);
+					ends.swap (stops);
+					count = 0;
+					for (size_t i = 0; i < values.size(); i++)
+						count += ends[i] - values[i] + 1;
+					break;
+				}
+			}
+		}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Reset bits in the range [spos, epos)                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+		void Reset (size_t spos, size_t epos) {
+			switch (type) {
+				case ARRAY: {
+					const size_t first = LowerBound (values, spos);
+					const size_t last = LowerBound (values, epos);
+					values.erase (values.begin() + first, values.begin() + last);
+					count = values.size();
+					break;
+				}
+				case BITMAP:
+					count -= BitField::CountBits (bits.data(), spos, epos);
+					BitField::ResetBits (bits.data(), spos, epos);
+					if (count <= ARRAY_LIMIT)
+						ToArray();
+					break;
+				default: {
+					vector <uint16_t> starts, stops;
+					for (size_t i = 0; i < values.size(); i++) {
+						if (ends[i] < spos || values[i] >= epos) {
+							starts.push_back (values[i]);
+							stops.push_back (ends[i]);
+						}
+						else {
+							if (values[i] < spos) {
+								starts.push_back (values[i]);
+								stops.push_back (static_cast <uint16_t> (spos - 1));
+							}
+							if (ends[i] >= epos) {
+								starts.push_back (static_cast <uint16_t> (epos));
+								stops.push_back (ends[i]);
+							}
+						}
+					}
+					values.swap (starts);
+					ends.swap (stops);
+					count = 0;
+					for (size_t i = 0; i < values.size(); i++)
+						count += ends[i] - values[i] + 1;
+					break;
+				}
+			}
+		}
+	};
+
+//============================================================================//
+//      Members                                                               //
+//============================================================================//
+private:
+	vector <size_t>		keys;		// Sorted keys of the containers
+	vector <Container>	chunks;		// Non-empty containers sorted by the key
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Index of the first container with the key greater or equal to target  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Lookup (size_t key) const {
+		size_t index = Array::FindGreatOrEqualAsc (keys.data(), keys.size(), key);
+		return index == NOT_FOUND ? keys.size() : index;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Get the container with the key, create an empty one if missing        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	Container& Fetch (size_t key) {
+		size_t index = Lookup (key);
+		if (index == chunks.size() || keys[index] != key) {
+			keys.insert (keys.begin() + index, key);
+			chunks.insert (chunks.begin() + index, Container (key));
+		}
+		return chunks[index];
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Constructor                                                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	RoaringBitmap (void) {}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Constructor from a dense bit field                                    //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	RoaringBitmap (
+		const uint64_t array[],		// Bit field
+		size_t size					// Size of the bit field in bits
+	){
+		for (size_t spos = 0; spos < size; spos += CHUNK_BITS) {
+			const size_t epos = min (size, spos + CHUNK_BITS);
+			const size_t count = BitField::CountBits (array, spos, epos);
+			if (!count)
+				continue;
+			Container chunk (spos / CHUNK_BITS);
+			chunk.count = count;
+			if (count > ARRAY_LIMIT) {
+
+				// Copy the words of the chunk and clear the bits past the end
+				const size_t words = (epos - spos + 63) / 64;
+				chunk.type = BITMAP;
+				chunk.bits.assign (CHUNK_WORDS, 0);
+				Array::Copy (chunk.bits.data(), array + spos / 64, words);
+				BitField::ResetBits (chunk.bits.data(), epos - spos, CHUNK_BITS);
+			}
+			else {
+
+				// Collect the positions of the set bits
+				chunk.values.reserve (count);
+				size_t pos = BitField::FindSetBitFwd (array, spos, epos);
+				while (pos != NOT_FOUND) {
+					chunk.values.push_back (static_cast <uint16_t> (pos - spos));
+					pos = BitField::FindSetBitFwd (array, pos + 1, epos);
+				}
+			}
+			keys.push_back (chunk.key);
+			chunks.push_back (chunk);
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Export the bitmap to a dense bit field of the target size             //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void ToBitField (
+		uint64_t array[],			// Bit field
+		size_t size					// Size of the bit field in bits
+	) const {
+		Array::Init (array, (size + 63) / 64, static_cast <uint64_t> (0));
+		for (const Container &chunk : chunks) {
+			const size_t base = chunk.key * CHUNK_BITS;
+			if (base >= size)
+				break;
+			const size_t limit = size - base;
+			switch (chunk.type) {
+				case ARRAY:
+					for (size_t i = 0; i < chunk.values.size() && chunk.values[i] < limit; i++)
+						BitField::SetBit (array, base + chunk.values[i]);
+					break;
+				case BITMAP: {
+					const size_t words = min (CHUNK_WORDS, (limit + 63) / 64);
+					Array::Copy (array + base / 64, chunk.bits.data(), words);
+					BitField::ResetBits (array, size, base + words * 64);
+					break;
+				}
+				default:
+					for (size_t i = 0; i < chunk.values.size() && chunk.values[i] < limit; i++)
+						BitField::SetBits (array, base + chunk.values[i], base + min <size_t> (chunk.ends[i] + 1, limit));
+					break;
+			}
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Get bit value                                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool GetBit (size_t pos) const {
+		const size_t index = Lookup (pos / CHUNK_BITS);
+		if (index == keys.size() || keys[index] != pos / CHUNK_BITS)
+			return false;
+		return chunks[index].Get (pos % CHUNK_BITS);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Set bit value                                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void SetBit (size_t pos) {
+		SetBits (pos, pos + 1);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Set bits in the range [spos, epos)                                    //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void SetBits (size_t spos, size_t epos) {
+		while (spos < epos) {
+			const size_t base = spos / CHUNK_BITS * CHUNK_BITS;
+			const size_t hi = min (epos - base, CHUNK_BITS);
+			Container &chunk = Fetch (spos / CHUNK_BITS);
+			if (spos == base && hi == CHUNK_BITS) {
+
+				// The full chunk is a single run
+				chunk = Container (chunk.key);
+				chunk.type = RUN;
+				chunk.count = CHUNK_BITS;
+				chunk.values.push_back (0);
+				chunk.ends.push_back (CHUNK_BITS - 1);
+			}
+			else
+				chunk.Set (spos - base, hi);
+			spos = base + hi;
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Reset bit value                                                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void ResetBit (size_t pos) {
+		ResetBits (pos, pos + 1);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Reset bits in the range [spos, epos)                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void ResetBits (size_t spos, size_t epos) {
+		if (spos >= epos)
+			return;
+		size_t index = Lookup (spos / CHUNK_BITS);
+		while (index < chunks.size() && chunks[index].key * CHUNK_BITS < epos) {
+			Container &chunk = chunks[index];
+			const size_t base = chunk.key * CHUNK_BITS;
+			const size_t lo = spos > base ? spos - base : 0;
+			const size_t hi = min (epos - base, CHUNK_BITS);
+			chunk.Reset (lo, hi);
+			if (chunk.count)
+				index++;
+			else {
+				keys.erase (keys.begin() + index);
+				chunks.erase (chunks.begin() + index);
+			}
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count set bits in the range [spos, epos)                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t CountBits (size_t spos, size_t epos) const {
+		size_t total = 0;
+		if (spos >= epos)
+			return total;
+		for (size_t i = Lookup (spos / CHUNK_BITS); i < chunks.size(); i++) {
+			const Container &chunk = chunks[i];
+			const size_t base = chunk.key * CHUNK_BITS;
+			if (base >= epos)
+				break;
+			const size_t lo = spos > base ? spos - base : 0;
+			const size_t hi = min (epos - base, CHUNK_BITS);
+			total += chunk.Count (lo, hi);
+		}
+		return total;
+	}
+	size_t CountBits (void) const {
+		size_t total = 0;
+		for (const Container &chunk : chunks)
+			total += chunk.count;
+		return total;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Search for the first set bit in the range [spos, epos)                //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t FindSetBitFwd (size_t spos, size_t epos) const {
+		if (spos >= epos)
+			return NOT_FOUND;
+		for (size_t i = Lookup (spos / CHUNK_BITS); i < chunks.size(); i++) {
+			const Container &chunk = chunks[i];
+			const size_t base = chunk.key * CHUNK_BITS;
+			if (base >= epos)
+				break;
+			const size_t lo = spos > base ? spos - base : 0;
+			const size_t hi = min (epos - base, CHUNK_BITS);
+			const size_t pos = chunk.Find (lo, hi);
+			if (pos != NOT_FOUND)
+				return base + pos;
+		}
+		return NOT_FOUND;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Convert each container to its cheapest representation                //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void Optimize (void) {
+		for (Container &chunk : chunks)
+			chunk.Optimize();
+		keys.shrink_to_fit();
+		chunks.shrink_to_fit();
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count of containers of the target type                                //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Containers (Type type) const {
+		size_t total = 0;
+		for (const Container &chunk : chunks)
+			total += chunk.type == type;
+		return total;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Memory used by the bitmap in bytes                                    //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Memory (void) const {
+		size_t total = sizeof (*this) + keys.capacity() * sizeof (size_t) + chunks.capacity() * sizeof (Container);
+		for (const Container &chunk : chunks)
+			total += chunk.Bytes();
+		return total;
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
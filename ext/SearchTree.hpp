@@ -0,0 +1,379 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                    STATIC SEARCH TREES OVER SORTED ARRAYS                    #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<vector>
+# include	<limits>
+# include	<type_traits>
+# include	<Array.h>
+
+using namespace std;
+
+//****************************************************************************//
+//      Eytzinger layout of a sorted array                                    //
+//****************************************************************************//
+
+// Read-only search index built from an ascending array of integers. The
+// elements are stored in the breadth-first order of a complete binary search
+// tree (the children of the node "k" are "2k" and "2k + 1"), so the first
+// levels of the tree share a few cache lines. The tree is stored in 64-byte
+// aligned lines, and the descendants of a node log2 (64 / sizeof (T)) levels
+// below it (four levels for 4-byte keys) fill exactly one line, which is
+// prefetched ahead of the search. The search loop has no unpredictable
+// branches. The sorted index of each node is kept next to the tree. The find
+// functions have the semantics of the Array:: binary searches for ascending
+// arrays, and return -1 if nothing is found.
+template <typename T>
+class EytzingerTree
+{
+	static_assert (is_integral_v <T>, "EytzingerTree: integer types only");
+
+//============================================================================//
+//      Constants                                                             //
+//============================================================================//
+public:
+	static constexpr size_t LINE_KEYS = 64 / sizeof (T);	// Keys in a cache line
+
+//============================================================================//
+//      Types                                                                 //
+//============================================================================//
+private:
+	struct alignas (64) Line
+	{
+		T	key [LINE_KEYS];	// Keys of the line
+	};
+
+//============================================================================//
+//      Members                                                               //
+//============================================================================//
+private:
+	vector <Line>	tree;		// Keys in the breadth-first order (1-based)
+	vector <size_t>	rank;		// Index of each node in the sorted array
+	size_t			size;		// Count of keys
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Key of the node                                                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	T& Key (size_t node) {
+		return tree[node / LINE_KEYS].key[node % LINE_KEYS];
+	}
+	const T& Key (size_t node) const {
+		return tree[node / LINE_KEYS].key[node % LINE_KEYS];
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Fill the tree by the in-order walk                                    //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void Build (const T array[], size_t &index, size_t node) {
+		if (node <= size) {
+			Build (array, index, 2 * node);
+			Key (node) = array[index];
+			rank[node] = index++;
+			Build (array, index, 2 * node + 1);
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Node of the first key that is greater (or equal) than the value       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Returns 0 if there is no such key
+	size_t Bound (T value, bool upper) const {
+		size_t node = 1;
+		if (upper) {
+			while (node <= size) {
+				__builtin_prefetch (tree.data() + node);
+				node = 2 * node + (Key (node) <= value);
+			}
+		}
+		else {
+			while (node <= size) {
+				__builtin_prefetch (tree.data() + node);
+				node = 2 * node + (Key (node) < value);
+			}
+		}
+
+		// The last turn to the left is the answer: drop the trailing right turns
+		return node >> __builtin_ffsll (~node);
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Constructor                                                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	EytzingerTree (const T array[], size_t size)
+	:	tree (size / LINE_KEYS + 1),
+		rank (size + 1),
+		size (size)
+	{
+		size_t index = 0;
+		Build (array, index, 1);
+		rank[0] = size;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count of keys                                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Size (void) const {
+		return size;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Memory used by the index (bytes)                                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Memory (void) const {
+		return tree.size() * sizeof (Line) + rank.size() * sizeof (size_t);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Searching for the first equal element                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t FindFirstEqual (T value) const {
+		const size_t node = Bound (value, false);
+		return node && Key (node) == value ? rank[node] : static_cast <size_t> (-1);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Searching for the last equal element                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t FindLastEqual (T value) const {
+		const size_t node = Bound (value, false);
+		return node && Key (node) == value ? rank[Bound (value, true)] - 1 : static_cast <size_t> (-1);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Searching for a greater element                                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t FindGreat (T value) const {
+		const size_t node = Bound (value, true);
+		return node ? rank[node] : static_cast <size_t> (-1);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Searching for a greater or equal element                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t FindGreatOrEqual (T value) const {
+		const size_t node = Bound (value, false);
+		return node ? rank[node] : static_cast <size_t> (-1);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Searching for a less element                                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t FindLess (T value) const {
+		return rank[Bound (value, false)] - 1;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Searching for a less or equal element                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t FindLessOrEqual (T value) const {
+		return rank[Bound (value, true)] - 1;
+	}
+};
+
+//****************************************************************************//
+//      Static B+ tree (S-tree) of a sorted array                             //
+//****************************************************************************//
+
+// Read-only search index built from an ascending array of integers. The keys
+// are split in nodes of one cache line, and the leaves hold all the keys in the
+// sorted order (the last leaf is padded by the largest value of the type). An
+// inner node of B keys has B + 1 children, and its key "i" is the first key of
+// the child "i + 1". A search reads one cache line per level: the node is
+// searched by counting its keys that are less than the value, with no branches,
+// and the count loop is vectorized by the compiler. The find functions have the
+// semantics of the Array:: binary searches for ascending arrays, and return -1
+// if nothing is found.
+template <typename T>
+class STree
+{
+	static_assert (is_integral_v <T>, "STree: integer types only");
+
+//============================================================================//
+//      Constants                                                             //
+//============================================================================//
+public:
+	static constexpr size_t NODE_KEYS = 64 / sizeof (T);	// Keys in a node (one cache line)
+
+//============================================================================//
+//      Types                                                                 //
+//============================================================================//
+private:
+	struct alignas (64) Node
+	{
+		T	key [NODE_KEYS];	// Keys of the node
+	};
+
+//============================================================================//
+//      Members                                                               //
+//============================================================================//
+private:
+	vector <Node>	nodes;		// Nodes of all the levels, the leaves first
+	vector <size_t>	offset;		// Index of the first node of each level
+	size_t			size;		// Count of keys
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count of the node keys that are less (or not greater) than the value  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static size_t Count (const Node &node, T value, bool upper) {
+		size_t count = 0;
+		if (upper) {
+			for (size_t i = 0; i < NODE_KEYS; i++)
+				count += node.key[i] <= value;
+		}
+		else {
+			for (size_t i = 0; i < NODE_KEYS; i++)
+				count += node.key[i] < value;
+		}
+		return count;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Index of the first key that is greater (or equal) than the value      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Returns the count of keys if there is no such key
+	size_t Bound (T value, bool upper) const {
+		if (size == 0)
+			return 0;
+
+		// No key is greater than the largest value of the type, and the
+		// padding keys must not be passed
+		if (upper && value == numeric_limits <T>::max())
+			return size;
+		size_t node = 0;
+		for (size_t level = offset.size() - 1; level > 0; level--)
+			node = node * (NODE_KEYS + 1) + Count (nodes[offset[level] + node], value, upper);
+		return min (node * NODE_KEYS + Count (nodes[node], value, upper), size);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Key at the sorted index                                               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	T Key (size_t index) const {
+		return nodes[index / NODE_KEYS].key[index % NODE_KEYS];
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Constructor                                                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	STree (const T array[], size_t size)
+	:	size (size)
+	{
+		// Leaves
+		const size_t leaves = (size + NODE_KEYS - 1) / NODE_KEYS;
+		nodes.resize (leaves);
+		offset.push_back (0);
+		for (size_t i = 0; i < leaves * NODE_KEYS; i++)
+			nodes[i / NODE_KEYS].key[i % NODE_KEYS] = i < size ? array[i] : numeric_limits <T>::max();
+
+		// Inner levels up to the root. The child "c" of a node on the level
+		// spans "span" leaves starting from the leaf c * span
+		size_t count = leaves;
+		size_t span = 1;
+		while (count > 1) {
+			const size_t children = count;
+			count = (count + NODE_KEYS) / (NODE_KEYS + 1);
+			offset.push_back (nodes.size());
+			for (size_t n = 0; n < count; n++) {
+				Node node;
+				for (size_t i = 0; i < NODE_KEYS; i++) {
+					const size_t child = n * (NODE_KEYS + 1) + i + 1;
+					node.key[i] = child < children ? Key (child * span * NODE_KEYS) : numeric_limits <T>::max();
+				}
+				nodes.push_back (node);
+			}
+			span *= NODE_KEYS + 1;
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count of keys                                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Size (void) const {
+		return size;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Memory used by the index (bytes)                                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Memory (void) const {
+		return nodes.size() * sizeof (Node) + offset.size() * sizeof (size_t);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Searching for the first equal element                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t FindFirstEqual (T value) const {
+		const size_t index = Bound (value, false);
+		return index < size && Key (index) == value ? index : static_cast <size_t> (-1);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Searching for the last equal element                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t FindLastEqual (T value) const {
+		const size_t index = Bound (value, false);
+		return index < size && Key (index) == value ? Bound (value, true) - 1 : static_cast <size_t> (-1);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Searching for a greater element                                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t FindGreat (T value) const {
+		const size_t index = Bound (value, true);
+		return index < size ? index : static_cast <size_t> (-1);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Searching for a greater or equal element                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t FindGreatOrEqual (T value) const {
+		const size_t index = Bound (value, false);
+		return index < size ? index : static_cast <size_t> (-1);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Searching for a less element                                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t FindLess (T value) const {
+		return Bound (value, false) - 1;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Searching for a less or equal element                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t FindLessOrEqual (T value) const {
+		return Bound (value, true) - 1;
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
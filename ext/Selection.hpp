@@ -0,0 +1,278 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                        SELECTION OF ORDER STATISTICS                         #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<vector>
+# include	<algorithm>
+# include	<functional>
+# include	<type_traits>
+# include	<Array.h>
+
+using namespace std;
+
+//****************************************************************************//
+//      Selection of order statistics                                         //
+//****************************************************************************//
+
+// Finds the n-th smallest elements of an array without sorting all of it. The
+// pivots are taken from a sorted sample of the current range at the rank that
+// matches the wanted element, so the range shrinks fast towards it, and the
+// range is split in three parts (less, equal and greater than the pivot), so
+// runs of duplicates are finished in one pass. The extremes and constant arrays
+// are sized by Array::MinMax and Array::Count instead of being partitioned. The
+// top-k functions keep a heap of k elements if k is small against the array
+// size, and select and sort the first k elements otherwise. The quantiles are
+// selected together: each pivot splits the ranks between the two sides. The
+// arrays must not contain NaN values.
+class Selection
+{
+//============================================================================//
+//      Constants                                                             //
+//============================================================================//
+public:
+	static constexpr size_t INSERT_SIZE = 64;		// Ranges of this size or less are sorted by insertion
+	static constexpr size_t SAMPLE_SIZE = 63;		// Count of elements in the pivot sample
+	static constexpr size_t MAX_LEVELS = 64;		// Partition levels before the fallback to std::nth_element
+	static constexpr size_t HEAP_RATIO = 64;		// Top-k uses a heap if k is less than size / ratio
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Insertion sort of a small range                                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void Insert (T array[], size_t size) {
+		for (size_t i = 1; i < size; i++) {
+			const T value = array[i];
+			size_t j = i;
+			for (; j > 0 && value < array[j - 1]; j--)
+				array[j] = array[j - 1];
+			array[j] = value;
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Pivot from a sorted sample at the rank of the wanted element          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static T Pivot (const T array[], size_t size, size_t n) {
+		T sample [SAMPLE_SIZE];
+		const size_t step = size / SAMPLE_SIZE;
+		for (size_t i = 0; i < SAMPLE_SIZE; i++)
+			sample[i] = array[i * step + step / 2];
+		Insert (sample, SAMPLE_SIZE);
+		return sample[n * SAMPLE_SIZE / size];
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Split the range in elements less, equal and greater than the pivot    //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Returns the bounds of the equal part in "lt" and "gt"
+	template <typename T>
+	static void Partition (T array[], size_t size, T pivot, size_t &lt, size_t &gt) {
+		size_t i = 0;
+		lt = 0;
+		gt = size;
+		while (i < gt) {
+			if (array[i] < pivot)
+				swap (array[lt++], array[i++]);
+			else if (pivot < array[i])
+				swap (array[i], array[--gt]);
+			else
+				i++;
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Move the extreme value to the target position                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void PlaceValue (T array[], size_t size, size_t n, T value) {
+		for (size_t i = 0; i < size; i++) {
+			if (array[i] == value) {
+				swap (array[i], array[n]);
+				return;
+			}
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Select the n-th element of the range                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void Select (T array[], size_t size, size_t n) {
+		for (size_t level = 0; size > INSERT_SIZE; level++) {
+			if (level == MAX_LEVELS) {
+				nth_element (array, array + n, array + size);
+				return;
+			}
+			const T pivot = Pivot (array, size, n);
+			size_t lt, gt;
+			Partition (array, size, pivot, lt, gt);
+			if (n < lt)
+				size = lt;
+			else if (n >= gt) {
+				array += gt;
+				size -= gt;
+				n -= gt;
+			}
+			else
+				return;
+		}
+		Insert (array, size);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Select the ranks of the range                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// The ranks are sorted and relative to the range
+	template <typename T>
+	static void SelectMany (T array[], size_t size, const size_t ranks[], size_t count) {
+		if (count == 0 || size <= INSERT_SIZE) {
+			if (count)
+				Insert (array, size);
+			return;
+		}
+		const size_t middle = count / 2;
+		const size_t n = ranks[middle];
+		Select (array, size, n);
+
+		// Elements around the n-th one are split by it, so the other ranks
+		// are selected in the parts on both sides
+		SelectMany (array, n, ranks, middle);
+		size_t right = middle + 1;
+		while (right < count && ranks[right] == n)
+			right++;
+		vector <size_t> shifted (ranks + right, ranks + count);
+		for (size_t &rank : shifted)
+			rank -= n + 1;
+		SelectMany (array + n + 1, size - n - 1, shifted.data(), shifted.size());
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Top k elements of the array in the comparator order                   //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T, typename C>
+	static void Top (T target[], const T array[], size_t size, size_t k, C cmp) {
+		k = min (k, size);
+		if (k == 0)
+			return;
+		if (k < size / HEAP_RATIO) {
+
+			// Small k: the heap root is the worst of the k best elements
+			Array::Copy (target, array, k);
+			make_heap (target, target + k, cmp);
+			for (size_t i = k; i < size; i++) {
+				if (cmp (array[i], target[0])) {
+					pop_heap (target, target + k, cmp);
+					target[k - 1] = array[i];
+					push_heap (target, target + k, cmp);
+				}
+			}
+			sort_heap (target, target + k, cmp);
+		}
+		else {
+
+			// Large k: select the k-th element of a copy and sort the part before it
+			vector <T> temp (size);
+			Array::Copy (temp.data(), array, size);
+			if constexpr (is_same_v <C, less <T>>) {
+				Select (temp.data(), size, k - 1);
+				Array::Copy (target, temp.data(), k);
+			}
+			else {
+				Select (temp.data(), size, size - k);
+				Array::Copy (target, temp.data() + size - k, k);
+			}
+			sort (target, target + k, cmp);
+		}
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      N-th smallest element                                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Reorders the array so that the element at the index "n" is the one that
+	// would be there if the array were sorted in ascending order, all the
+	// elements before it are not greater and all the elements after it are not
+	// less. Returns the element.
+	template <typename T>
+	static T NthElement (T array[], size_t size, size_t n) {
+		T min, max;
+		Array::MinMax (array, size, min, max);
+		if (min == max)
+			return min;
+		if (n == 0) {
+			PlaceValue (array, size, n, min);
+			return min;
+		}
+		if (n == size - 1) {
+			PlaceValue (array, size, n, max);
+			return max;
+		}
+		Select (array, size, n);
+		return array[n];
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Smallest elements                                                     //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Writes the "k" smallest elements of the array in ascending order
+	template <typename T>
+	static void SmallestK (T target[], const T array[], size_t size, size_t k) {
+		Top (target, array, size, k, less <T> ());
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Largest elements                                                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Writes the "k" largest elements of the array in descending order
+	template <typename T>
+	static void LargestK (T target[], const T array[], size_t size, size_t k) {
+		Top (target, array, size, k, greater <T> ());
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Quantiles                                                             //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Reorders the array and writes the quantiles of the levels in the range
+	// [0, 1]. The quantile of the level "q" is the element at the index
+	// q * (size - 1), rounded down, of the sorted array.
+	template <typename T>
+	static void Quantiles (T target[], T array[], size_t size, const flt64_t levels[], size_t count) {
+		if (size == 0)
+			return;
+		vector <size_t> ranks (count);
+		for (size_t i = 0; i < count; i++)
+			ranks[i] = min (static_cast <size_t> (levels[i] * (size - 1)), size - 1);
+		vector <size_t> sorted (ranks);
+		sort (sorted.begin(), sorted.end());
+		sorted.erase (unique (sorted.begin(), sorted.end()), sorted.end());
+		if (Array::Count (array, size, array[0]) == size)
+			Array::Init (target, count, array[0]);
+		else {
+			SelectMany (array, size, sorted.data(), sorted.size());
+			for (size_t i = 0; i < count; i++)
+				target[i] = array[ranks[i]];
+		}
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
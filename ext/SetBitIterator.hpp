@@ -0,0 +1,141 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                    ITERATOR OVER SET BITS OF A BIT FIELD                     #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<BitField.h>
+
+using namespace std;
+
+//****************************************************************************//
+//      Iterator over set bits of a bit field                                 //
+//****************************************************************************//
+
+// Enumerates positions of set bits in the range [spos, epos) in ascending
+// order. A nonzero word is decoded in place by clearing its lowest set bit at
+// each step. A zero word means a sparse region, so the iterator jumps over it
+// with a single BitField::FindSetBitFwd call instead of loading every word.
+class SetBitIterator
+{
+//============================================================================//
+//      Constants                                                             //
+//============================================================================//
+public:
+	static constexpr size_t NOT_FOUND = static_cast <size_t> (-1);
+
+//============================================================================//
+//      Members                                                               //
+//============================================================================//
+private:
+	const uint64_t	*array;		// Bit field
+	size_t			spos;		// Start position of the range
+	size_t			epos;		// End position of the range
+	size_t			index;		// Index of the current word
+	size_t			words;		// Count of words covering the range
+	uint64_t		word;		// Not yet visited bits of the current word
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Load a word masking the bits out of the range                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	uint64_t Load (size_t index) const {
+		uint64_t value = array[index];
+		if (index == spos / 64)
+			value &= ~static_cast <uint64_t> (0) << (spos % 64);
+		if (index == words - 1 && epos % 64)
+			value &= ~(~static_cast <uint64_t> (0) << (epos % 64));
+		return value;
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Constructor                                                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	SetBitIterator (
+		const uint64_t array[],	// Bit field
+		size_t spos,			// Start position of the range
+		size_t epos				// End position of the range
+	) :	array (array),
+		spos (spos),
+		epos (epos),
+		index (spos / 64),
+		words (spos < epos ? (epos + 63) / 64 : 0),
+		word (spos < epos ? Load (spos / 64) : 0)
+	{}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Position of the next set bit or NOT_FOUND                             //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Next (void) {
+		while (!word) {
+			if (++index >= words)
+				return NOT_FOUND;
+			word = Load (index);
+			if (!word) {
+
+				// Sparse region: skip all the zero words in one call
+				const size_t start = (index + 1) * 64;
+				const size_t pos = start < epos ? BitField::FindSetBitFwd (array, start, epos) : NOT_FOUND;
+				if (pos == NOT_FOUND) {
+					index = words;
+					return NOT_FOUND;
+				}
+				index = pos / 64;
+				word = Load (index);
+			}
+		}
+		const size_t pos = index * 64 + __builtin_ctzll (word);
+		word &= word - 1;
+		return pos;
+	}
+};
+
+//****************************************************************************//
+//      Call the function for each set bit of the range                       //
+//****************************************************************************//
+template <typename F>
+void ForEachSetBit (
+	const uint64_t array[],		// Bit field
+	size_t spos,				// Start position of the range
+	size_t epos,				// End position of the range
+	F func						// Function to call with the bit position
+){
+	SetBitIterator iterator (array, spos, epos);
+	for (size_t pos = iterator.Next (); pos != SetBitIterator::NOT_FOUND; pos = iterator.Next ())
+		func (pos);
+}
+
+//****************************************************************************//
+//      Extract positions of set bits into an array                           //
+//****************************************************************************//
+
+// Returns the count of positions. The target array must be large enough to
+// hold BitField::CountBits (array, spos, epos) elements.
+inline size_t ExtractSetBits (
+	size_t target[],			// Target array of bit positions
+	const uint64_t array[],		// Bit field
+	size_t spos,				// Start position of the range
+	size_t epos					// End position of the range
+){
+	size_t count = 0;
+	ForEachSetBit (array, spos, epos, [&](size_t pos){ target[count++] = pos; });
+	return count;
+}
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,254 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                          OPERATIONS ON SORTED SETS                           #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<vector>
+# include	<algorithm>
+# include	<Array.h>
+# include	"Gallop.hpp"
+
+using namespace std;
+
+//****************************************************************************//
+//      Operations on sorted sets                                             //
+//****************************************************************************//
+
+// Intersection, union and difference of sets stored as strictly ascending
+// integer arrays. Sets of similar sizes are merged in one pass. If one set is
+// much larger than the other one, the elements of the small set are searched in
+// the large set instead: the search gallops from the last position
+// (Gallop::LowerAsc), so the cost is O(m log(n / m)) and not O(m + n). The runs
+// of the large set between the found positions are copied by Array::Copy. The
+// k-way intersection takes the candidates from the smallest set and gallops in
+// all the other ones. All the functions return the count of elements written to
+// the target array, which must have room for the largest possible result.
+class SortedSet
+{
+//============================================================================//
+//      Types                                                                 //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Algorithm of the operation                                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	enum Path
+	{
+		AUTO,					// Choose by the size ratio
+		MERGE,					// Merge both sets
+		GALLOP					// Search the elements of the smaller set in the larger one
+	};
+
+//============================================================================//
+//      Constants                                                             //
+//============================================================================//
+public:
+	static constexpr size_t GALLOP_RATIO = 32;		// Size ratio of the sets to gallop instead of merging
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Choose the algorithm by the size ratio                                //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static bool IsSkewed (size_t size1, size_t size2, Path path) {
+		if (path == AUTO)
+			return min (size1, size2) * GALLOP_RATIO < max (size1, size2);
+		return path == GALLOP;
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Intersection                                                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// The target must have room for min (size1, size2) elements
+	template <typename T>
+	static size_t Intersection (T target[], const T set1[], size_t size1, const T set2[], size_t size2, Path path = AUTO) {
+		size_t count = 0;
+		if (IsSkewed (size1, size2, path)) {
+
+			// Search the elements of the small set in the large set
+			if (size1 > size2) {
+				swap (set1, set2);
+				swap (size1, size2);
+			}
+			size_t j = 0;
+			for (size_t i = 0; i < size1 && j < size2; i++) {
+				j = Gallop::LowerAsc (set2, size2, j, set1[i]);
+				if (j < size2 && set2[j] == set1[i])
+					target[count++] = set2[j++];
+			}
+		}
+		else {
+
+			// Merge both sets
+			size_t i = 0, j = 0;
+			while (i < size1 && j < size2) {
+				if (set1[i] < set2[j])
+					i++;
+				else if (set2[j] < set1[i])
+					j++;
+				else {
+					target[count++] = set1[i];
+					i++;
+					j++;
+				}
+			}
+		}
+		return count;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Union                                                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// The target must have room for size1 + size2 elements
+	template <typename T>
+	static size_t Union (T target[], const T set1[], size_t size1, const T set2[], size_t size2, Path path = AUTO) {
+		size_t count = 0;
+		if (IsSkewed (size1, size2, path)) {
+
+			// Copy the runs of the large set between the elements of the small set
+			if (size1 > size2) {
+				swap (set1, set2);
+				swap (size1, size2);
+			}
+			size_t j = 0;
+			for (size_t i = 0; i < size1; i++) {
+				const size_t next = Gallop::LowerAsc (set2, size2, j, set1[i]);
+				Array::Copy (target + count, set2 + j, next - j);
+				count += next - j;
+				target[count++] = set1[i];
+				j = next < size2 && set2[next] == set1[i] ? next + 1 : next;
+			}
+			Array::Copy (target + count, set2 + j, size2 - j);
+			count += size2 - j;
+		}
+		else {
+
+			// Merge both sets
+			size_t i = 0, j = 0;
+			while (i < size1 && j < size2) {
+				if (set1[i] < set2[j])
+					target[count++] = set1[i++];
+				else if (set2[j] < set1[i])
+					target[count++] = set2[j++];
+				else {
+					target[count++] = set1[i];
+					i++;
+					j++;
+				}
+			}
+			Array::Copy (target + count, set1 + i, size1 - i);
+			count += size1 - i;
+			Array::Copy (target + count, set2 + j, size2 - j);
+			count += size2 - j;
+		}
+		return count;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Difference                                                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Elements of the first set that are not in the second set. The target must
+	// have room for size1 elements.
+	template <typename T>
+	static size_t Difference (T target[], const T set1[], size_t size1, const T set2[], size_t size2, Path path = AUTO) {
+		size_t count = 0;
+		if (IsSkewed (size1, size2, path)) {
+			if (size1 <= size2) {
+
+				// Keep the elements of the small set that are not found in the
+				// large set
+				size_t j = 0;
+				for (size_t i = 0; i < size1; i++) {
+					j = Gallop::LowerAsc (set2, size2, j, set1[i]);
+					if (j == size2 || set2[j] != set1[i])
+						target[count++] = set1[i];
+				}
+			}
+			else {
+
+				// Copy the runs of the large set between the elements of the
+				// small set
+				size_t i = 0;
+				for (size_t j = 0; j < size2 && i < size1; j++) {
+					const size_t next = Gallop::LowerAsc (set1, size1, i, set2[j]);
+					Array::Copy (target + count, set1 + i, next - i);
+					count += next - i;
+					i = next < size1 && set1[next] == set2[j] ? next + 1 : next;
+				}
+				Array::Copy (target + count, set1 + i, size1 - i);
+				count += size1 - i;
+			}
+		}
+		else {
+
+			// Merge both sets
+			size_t i = 0, j = 0;
+			while (i < size1 && j < size2) {
+				if (set1[i] < set2[j])
+					target[count++] = set1[i++];
+				else if (set2[j] < set1[i])
+					j++;
+				else {
+					i++;
+					j++;
+				}
+			}
+			Array::Copy (target + count, set1 + i, size1 - i);
+			count += size1 - i;
+		}
+		return count;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Intersection of many sets                                             //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// The target must have room for the size of the smallest set
+	template <typename T>
+	static size_t Intersection (T target[], const T* const sets[], const size_t sizes[], size_t count) {
+		if (count == 0)
+			return 0;
+
+		// Visit the sets from the smallest one, so the candidates are few and
+		// the misses are found early
+		vector <size_t> order (count), position (count, 0);
+		for (size_t i = 0; i < count; i++)
+			order[i] = i;
+		sort (order.begin(), order.end(), [sizes](size_t a, size_t b){ return sizes[a] < sizes[b]; });
+		const T *first = sets[order[0]];
+		size_t result = 0;
+		for (size_t i = 0; i < sizes[order[0]]; i++) {
+			const T value = first[i];
+			bool found = true;
+			for (size_t k = 1; k < count && found; k++) {
+				const size_t s = order[k];
+				position[s] = Gallop::LowerAsc (sets[s], sizes[s], position[s], value);
+				if (position[s] == sizes[s])
+					return result;
+				found = sets[s][position[s]] == value;
+			}
+			if (found)
+				target[result++] = value;
+		}
+		return result;
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
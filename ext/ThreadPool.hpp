@@ -0,0 +1,154 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                            POOL OF WORKER THREADS                            #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<vector>
+# include	<thread>
+# include	<mutex>
+# include	<atomic>
+# include	<functional>
+# include	<condition_variable>
+# include	<algorithm>
+
+using namespace std;
+
+//****************************************************************************//
+//      Pool of worker threads                                                //
+//****************************************************************************//
+
+// Runs a batch of independent tasks on the worker threads and the calling
+// thread. Tasks are handed out one by one from a shared counter, so faster
+// threads take more tasks. Run blocks until all the tasks of the batch are
+// done. A pool of 1 thread runs the tasks in the calling thread.
+class ThreadPool
+{
+//============================================================================//
+//      Members                                                               //
+//============================================================================//
+private:
+	vector <thread>				workers;	// Worker threads
+	mutex						lock;		// Lock of the batch state
+	condition_variable			wake;		// New batch or stop signal
+	condition_variable			done;		// All the workers finished the batch
+	function <void (size_t)>	job;		// Task function of the batch
+	atomic <size_t>				next;		// Index of the next task
+	size_t						tasks;		// Count of tasks in the batch
+	size_t						active;		// Count of workers busy with the batch
+	size_t						batch;		// Batch number
+	bool						stop;		// Stop the workers
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Run the tasks of the current batch until there are no more            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void Drain (void) {
+		for (size_t i = next++; i < tasks; i = next++)
+			job (i);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Worker thread loop                                                    //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void Work (void) {
+		size_t seen = 0;
+		unique_lock <mutex> guard (lock);
+		while (true) {
+			wake.wait (guard, [&]{ return stop || batch != seen; });
+			if (stop)
+				return;
+			seen = batch;
+			guard.unlock ();
+			Drain ();
+			guard.lock ();
+			if (--active == 0)
+				done.notify_one ();
+		}
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Constructor                                                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	ThreadPool (
+		size_t threads = thread::hardware_concurrency ()	// Count of threads including the calling one
+	) :	next (0),
+		tasks (0),
+		active (0),
+		batch (0),
+		stop (false)
+	{
+		for (size_t i = 1; i < max <size_t> (threads, 1); i++)
+			workers.emplace_back (&ThreadPool::Work, this);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Destructor                                                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	~ThreadPool (void) {
+		{
+			lock_guard <mutex> guard (lock);
+			stop = true;
+		}
+		wake.notify_all ();
+		for (thread &worker : workers)
+			worker.join ();
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count of threads including the calling one                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Size (void) const {
+		return workers.size() + 1;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Run the function for each task index in [0, count)                    //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename F>
+	void Run (size_t count, F &&func) {
+		if (count <= 1 || workers.empty()) {
+			for (size_t i = 0; i < count; i++)
+				func (i);
+			return;
+		}
+		{
+			lock_guard <mutex> guard (lock);
+			job = std::ref (func);
+			tasks = count;
+			next = 0;
+			active = workers.size();
+			batch++;
+		}
+		wake.notify_all ();
+		Drain ();
+		unique_lock <mutex> guard (lock);
+		done.wait (guard, [&]{ return active == 0; });
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Shared pool of all the hardware threads                               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static ThreadPool& Default (void) {
+		static ThreadPool pool;
+		return pool;
+	}
+};
+
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/